@@ -0,0 +1,137 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+// system
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <vector>
+// cisst/saw
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaThread.h>
+#include <sawRobotIO1394/osaConfigurationValidator1394.h>
+
+using namespace sawRobotIO1394;
+
+// validates files in parallel, each thread picks the next file available
+class Validator
+{
+public:
+    Validator(const std::vector<std::string> & files):
+        mFiles(files),
+        mIssues(files.size()),
+        mValid(files.size(), false)
+    {}
+
+    void * Run(int CMN_UNUSED(threadIndex)) {
+        size_t index;
+        while ((index = mNext++) < mFiles.size()) {
+            mValid[index] = osaConfigurationValidator1394Check(mFiles[index], mIssues[index]);
+        }
+        return nullptr;
+    }
+
+    const std::vector<std::string> & mFiles;
+    std::vector<std::vector<osaConfigurationIssue1394> > mIssues;
+    std::vector<char> mValid; // not vector<bool>, written by different threads
+    std::atomic<size_t> mNext {0};
+};
+
+int main(int argc, char * argv[])
+{
+    // log configuration, errors are reported by the validator
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::SetMaskDefaultLog(CMN_LOG_ALLOW_ALL);
+
+    cmnCommandLineOptions options;
+    std::list<std::string> configFiles;
+    int numberOfThreads = 4;
+    options.AddOptionMultipleValues("c", "config",
+                                    "configuration file(s), XML or JSON",
+                                    cmnCommandLineOptions::REQUIRED_OPTION, &configFiles);
+    options.AddOptionOneValue("j", "jobs",
+                              "number of files validated in parallel (default 4)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfThreads);
+    options.AddOptionNoValue("w", "no-warnings",
+                             "only report errors");
+
+    std::string errorMessage;
+    if (!options.Parse(argc, argv, errorMessage)) {
+        std::cerr << "Error: " << errorMessage << std::endl;
+        options.PrintUsage(std::cerr);
+        return -1;
+    }
+    const bool showWarnings = !options.IsSet("no-warnings");
+
+    const std::vector<std::string> files(configFiles.begin(), configFiles.end());
+    Validator validator(files);
+
+    // parse in parallel, never more threads than files
+    const size_t threadCount = std::max(static_cast<size_t>(1),
+                                        std::min(static_cast<size_t>(numberOfThreads), files.size()));
+    std::vector<std::unique_ptr<osaThread> > threads;
+    for (size_t index = 0; index < threadCount; ++index) {
+        threads.emplace_back(new osaThread);
+        threads.back()->Create<Validator, int>(&validator, &Validator::Run, static_cast<int>(index));
+    }
+    for (auto & thread : threads) {
+        thread->Wait();
+    }
+
+    // files that failed to parse are parsed again, one at a time, to
+    // capture the parser log messages
+    size_t errors = 0, warnings = 0, invalidFiles = 0;
+    for (size_t index = 0; index < files.size(); ++index) {
+        std::vector<osaConfigurationIssue1394> & issues = validator.mIssues[index];
+        std::stringstream parserLog;
+        if (!validator.mValid[index]
+            && (issues.size() == 1)
+            && (issues.front().Line == 0)) {
+            cmnLogger::AddChannel(parserLog, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+            std::vector<osaConfigurationIssue1394> unused;
+            osaConfigurationValidator1394Check(files[index], unused);
+            cmnLogger::RemoveChannel(parserLog);
+        }
+        for (const auto & issue : issues) {
+            if (issue.Severity == osaConfigurationIssue1394::ISSUE_ERROR) {
+                ++errors;
+                std::cout << issue << std::endl;
+            } else {
+                ++warnings;
+                if (showWarnings) {
+                    std::cout << issue << std::endl;
+                }
+            }
+        }
+        if (!parserLog.str().empty()) {
+            std::cout << parserLog.str();
+        }
+        if (!validator.mValid[index]) {
+            ++invalidFiles;
+        }
+    }
+
+    std::cout << files.size() << " file(s) checked, "
+              << invalidFiles << " invalid, "
+              << errors << " error(s), "
+              << warnings << " warning(s)" << std::endl;
+    return (invalidFiles == 0) ? 0 : 1;
+}
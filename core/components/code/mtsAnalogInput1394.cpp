@@ -0,0 +1,118 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstMultiTask/mtsInterfaceProvided.h>
+#include <cisstMultiTask/mtsStateTable.h>
+
+#include <sawRobotIO1394/mtsAnalogInput1394.h>
+
+#include "AmpIO.h"
+
+using namespace sawRobotIO1394;
+
+mtsAnalogInput1394::mtsAnalogInput1394(const cmnGenericObject & owner,
+                                       const osaAnalogInput1394Configuration & config):
+    OwnerServices(owner.Services())
+{
+    mStatistics.SetAll(0.0);
+    Configure(config);
+}
+
+void mtsAnalogInput1394::SetupStateTable(mtsStateTable & stateTable)
+{
+    stateTable.AddData(mBits, mName + "Bits");
+    stateTable.AddData(mValue, mName + "Value");
+    stateTable.AddData(mFilteredValue, mName + "FilteredValue");
+    stateTable.AddData(mStatistics, mName + "Statistics");
+}
+
+void mtsAnalogInput1394::SetupProvidedInterface(mtsInterfaceProvided * interfaceProvided, mtsStateTable & stateTable)
+{
+    interfaceProvided->AddCommandReadState(stateTable, this->mBits, "GetBits");
+    interfaceProvided->AddCommandReadState(stateTable, this->mValue, "GetValue");
+    interfaceProvided->AddCommandReadState(stateTable, this->mFilteredValue, "GetFilteredValue");
+    interfaceProvided->AddCommandReadState(stateTable, this->mStatistics, "GetStatistics");
+    interfaceProvided->AddEventWrite(this->FilteredValueEvent, "FilteredValue", 0.0);
+    interfaceProvided->AddEventWrite(this->StatisticsEvent, "Statistics", vctDouble3(0.0));
+}
+
+void mtsAnalogInput1394::Configure(const osaAnalogInput1394Configuration & config)
+{
+    mName = config.Name;
+    mAxisID = config.AxisID;
+    if ((mAxisID < 0) || (mAxisID >= static_cast<int>(MAX_AXES))) {
+        cmnThrow(mName + ": invalid axis ID for analog input.");
+    }
+    std::vector<double> fir(config.FIR.begin(), config.FIR.end());
+    std::string message;
+    if (!mFilter.Configure(fir, config.IIR, config.Decimation, config.Window, message)) {
+        cmnThrow(mName + ": invalid filter for analog input, " + message);
+    }
+    mConfiguration = config;
+}
+
+void mtsAnalogInput1394::SetBoard(AmpIO * board)
+{
+    if (board == 0) {
+        cmnThrow(this->Name() + ": invalid board pointer.");
+    }
+    mBoard = board;
+}
+
+void mtsAnalogInput1394::PollState(void)
+{
+    mBits = static_cast<int>(mBoard->GetAnalogInput(mAxisID));
+    mValue = mConfiguration.BitsToValue.Scale * mBits + mConfiguration.BitsToValue.Offset;
+    mFilteredValueUpdated = mFilter.Step(mValue);
+    if (mFilteredValueUpdated) {
+        mFilteredValue = mFilter.Value();
+    }
+    mStatisticsUpdated = mFilter.WindowCompleted();
+    if (mStatisticsUpdated) {
+        mStatistics.Assign(mFilter.Minimum(), mFilter.Maximum(), mFilter.Mean());
+    }
+}
+
+void mtsAnalogInput1394::CheckState(void)
+{
+    if (mFilteredValueUpdated) {
+        FilteredValueEvent(mFilteredValue);
+    }
+    if (mStatisticsUpdated) {
+        StatisticsEvent(mStatistics);
+    }
+}
+
+const osaAnalogInput1394Configuration & mtsAnalogInput1394::Configuration(void) const
+{
+    return mConfiguration;
+}
+
+const std::string & mtsAnalogInput1394::Name(void) const
+{
+    return mName;
+}
+
+const double & mtsAnalogInput1394::Value(void) const
+{
+    return mValue;
+}
+
+const double & mtsAnalogInput1394::FilteredValue(void) const
+{
+    return mFilteredValue;
+}
@@ -62,8 +62,14 @@ void mtsDallasChip1394::CheckState(void)
 void mtsDallasChip1394::Configure(const osaDallasChip1394Configuration & config)
 {
     // Store configuration
-    mConfiguration = config;
+    mConfiguration.Name = config.Name;
     mName = config.Name;
+    Reconfigure(config);
+}
+
+void mtsDallasChip1394::Reconfigure(const osaDallasChip1394Configuration & config)
+{
+    mConfiguration.BoardID = config.BoardID;
     mToolType = ToolTypeUndefined;
     mWaiting = false;
 }
@@ -76,12 +82,28 @@ void mtsDallasChip1394::SetBoard(AmpIO * board)
     mBoard = board;
 }
 
+void mtsDallasChip1394::SetBoardSnapshot(const osaBoardSnapshot1394 * snapshot)
+{
+    if (snapshot == 0) {
+        cmnThrow(this->Name() + ": invalid board snapshot pointer.");
+    }
+    mBoardSnapshot = snapshot;
+}
+
 void mtsDallasChip1394::PollState(void)
 {
     if (!mWaiting) {
         return;
     }
-    TriggerRead();
+    if ((mBoardSnapshot->FPGATime - mTimeLastPoll) < mPollPeriod) {
+        return;
+    }
+    Poll();
+}
+
+void mtsDallasChip1394::SetPollPeriod(const double & period)
+{
+    mPollPeriod = period;
 }
 
 const osaDallasChip1394Configuration & mtsDallasChip1394::Configuration(void) const
@@ -120,6 +142,15 @@ void mtsDallasChip1394::TriggerToolTypeEvent(const unsigned int & model,
 
 void mtsDallasChip1394::TriggerRead(void)
 {
+    if (mWaiting) {
+        return;
+    }
+    Poll();
+}
+
+void mtsDallasChip1394::Poll(void)
+{
+    mTimeLastPoll = mBoardSnapshot->FPGATime;
     uint32_t model;
     uint8_t version;
     std::string name;
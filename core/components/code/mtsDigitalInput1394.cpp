@@ -51,6 +51,7 @@ mtsDigitalInput1394::mtsDigitalInput1394(const cmnGenericObject & owner,
     mEventPayloads.Clicked.SetType(prmEventButton::CLICKED);
     mEventPayloads.Clicked.SetValid(true);
     Configure(config);
+    mEventPayloads.Edge.Input = mName;
 }
 
 mtsDigitalInput1394::~mtsDigitalInput1394()
@@ -70,6 +71,7 @@ void mtsDigitalInput1394::SetupProvidedInterface(mtsInterfaceProvided * prov, mt
 {
     prov->AddCommandReadState(stateTable, this->mValue, "GetButton");
     prov->AddEventWrite(this->Button, "Button", prmEventButton());
+    prov->AddEventWrite(this->ButtonEdge, "ButtonEdge", osaDigitalInputEdge1394());
 }
 
 void mtsDigitalInput1394::CheckState(void)
@@ -85,6 +87,7 @@ void mtsDigitalInput1394::CheckState(void)
                     mEventPayloads.Pressed.SetTimestamp(mStateTable->GetTic());
                 }
                 Button(mEventPayloads.Pressed);
+                SendEdge(osaDigitalInputEdge1394::PRESSED, mEdgeTime, mConfirmedTime);
             }
         } else {
             // Emit a release event if specified in config
@@ -93,6 +96,7 @@ void mtsDigitalInput1394::CheckState(void)
                     mEventPayloads.Released.SetTimestamp(mStateTable->GetTic());
                 }
                 Button(mEventPayloads.Released);
+                SendEdge(osaDigitalInputEdge1394::RELEASED, mEdgeTime, mConfirmedTime);
             }
         }
     }
@@ -102,11 +106,36 @@ void mtsDigitalInput1394::CheckState(void)
     }
 }
 
+void mtsDigitalInput1394::SendEdge(const osaDigitalInputEdge1394::EdgeType type,
+                                   const double edgeTime, const double confirmedTime)
+{
+    mEventPayloads.Edge.Type = type;
+    mEventPayloads.Edge.EdgeTime = edgeTime;
+    mEventPayloads.Edge.ConfirmedTime = confirmedTime;
+    if (mStateTable) {
+        mEventPayloads.Edge.Timestamp = mStateTable->GetTic();
+    }
+    ButtonEdge(mEventPayloads.Edge);
+}
+
 void mtsDigitalInput1394::Configure(const osaDigitalInput1394Configuration & config)
 {
     // Store configuration
-    mConfiguration = config;
+    mConfiguration.Name = config.Name;
     mName = config.Name;
+    Reconfigure(config);
+}
+
+void mtsDigitalInput1394::Reconfigure(const osaDigitalInput1394Configuration & config)
+{
+    mConfiguration.BoardID = config.BoardID;
+    mConfiguration.BitID = config.BitID;
+    mConfiguration.TriggerWhenPressed = config.TriggerWhenPressed;
+    mConfiguration.TriggerWhenReleased = config.TriggerWhenReleased;
+    mConfiguration.PressedValue = config.PressedValue;
+    mConfiguration.SkipFirstRun = config.SkipFirstRun;
+    mConfiguration.DebounceThreshold = config.DebounceThreshold;
+    mConfiguration.DebounceThresholdClick = config.DebounceThresholdClick;
     mBitID = config.BitID;
     mData->BitMask = 0x1 << mBitID;
     mPressedValue = config.PressedValue;
@@ -117,21 +146,26 @@ void mtsDigitalInput1394::Configure(const osaDigitalInput1394Configuration & con
     mDebounceThresholdClick = config.DebounceThresholdClick;
 }
 
-void mtsDigitalInput1394::SetBoard(AmpIO * board)
+void mtsDigitalInput1394::SetBoardSnapshot(const osaBoardSnapshot1394 * snapshot)
 {
-    if (board == 0) {
-        cmnThrow(this->Name() + ": invalid board pointer.");
+    if (snapshot == 0) {
+        cmnThrow(this->Name() + ": invalid board snapshot pointer.");
     }
-    mBoard = board;
+    mBoardSnapshot = snapshot;
 }
 
 void mtsDigitalInput1394::PollState(void)
+{
+    PollState(*mBoardSnapshot);
+}
+
+void mtsDigitalInput1394::PollState(const osaBoardSnapshot1394 & snapshot)
 {
     // Store previous value
     mPreviousValue = mValue;
 
     // Get the new value
-    mData->DigitalInputBits =  mBoard->GetDigitalInput();
+    mData->DigitalInputBits = snapshot.DigitalInput;
 
     // If the masked bit is low, set the value to the pressed value
     bool value = ((mData->DigitalInputBits & mData->BitMask)
@@ -139,6 +173,10 @@ void mtsDigitalInput1394::PollState(void)
 
     // No debounce needed
     if (mFirstRun || (mDebounceThreshold == 0.0)) {
+        if (mFirstRun || (value != mValue)) {
+            mEdgeTime = snapshot.FPGATime;
+            mConfirmedTime = snapshot.FPGATime;
+        }
         mValue = value;
         return;
     }
@@ -148,12 +186,13 @@ void mtsDigitalInput1394::PollState(void)
         if (value != mPreviousValue) {
             mDebounceCounter = 0.0;
             mTransitionValue = value;
+            mTransitionTime = snapshot.FPGATime;
         }
     // count consecutive equal values
     } else {
         if (mDebounceCounter < mDebounceThreshold) {
             if (value == mTransitionValue) {
-                mDebounceCounter += mBoard->GetTimestamp() * mBoard->GetFPGAClockPeriod();
+                mDebounceCounter += snapshot.TimestampSeconds;
             } else {
                 // click if button is now changed back and counter is short enough
                 if ((mDebounceThresholdClick != mDebounceThreshold) // click is activated
@@ -164,16 +203,29 @@ void mtsDigitalInput1394::PollState(void)
                         mEventPayloads.Clicked.SetTimestamp(mStateTable->GetTic());
                     }
                     Button(mEventPayloads.Clicked);
+                    SendEdge(osaDigitalInputEdge1394::CLICKED, mTransitionTime, snapshot.FPGATime);
                 }
                 mDebounceCounter = -1.0;
             }
         } else {
             mValue = value;
             mDebounceCounter = -1.0;
+            mEdgeTime = mTransitionTime;
+            mConfirmedTime = snapshot.FPGATime;
         }
     }
 }
 
+uint32_t mtsDigitalInput1394::BitMask(void) const
+{
+    return mData->BitMask;
+}
+
+bool mtsDigitalInput1394::Busy(void) const
+{
+    return mFirstRun || (mDebounceCounter >= 0.0) || (mValue != mPreviousValue);
+}
+
 const osaDigitalInput1394Configuration & mtsDigitalInput1394::Configuration(void) const
 {
     return mConfiguration;
@@ -193,3 +245,13 @@ const bool & mtsDigitalInput1394::PreviousValue(void) const
 {
     return mPreviousValue;
 }
+
+const double & mtsDigitalInput1394::EdgeTime(void) const
+{
+    return mEdgeTime;
+}
+
+const double & mtsDigitalInput1394::ConfirmedTime(void) const
+{
+    return mConfirmedTime;
+}
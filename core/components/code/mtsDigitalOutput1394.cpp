@@ -57,10 +57,15 @@ mtsDigitalOutput1394::~mtsDigitalOutput1394()
 void mtsDigitalOutput1394::SetupStateTable(mtsStateTable & stateTable)
 {
     stateTable.AddData(mValue, mName + "Value");
+    // updated in Write, after the read state table has advanced
+    stateTable.AddData(mTriggerCount, mName + "TriggerCount");
+    stateTable.AddData(mTriggerTime, mName + "TriggerTime");
 }
 
 void mtsDigitalOutput1394::SetupProvidedInterface(mtsInterfaceProvided * interfaceProvided, mtsStateTable & stateTable)
 {
+    mInterface = interfaceProvided;
+    interfaceProvided->AddMessageEvents();
     interfaceProvided->AddCommandReadState(stateTable, this->mValue, "GetValue");
     interfaceProvided->AddCommandWrite(&mtsDigitalOutput1394::SetValue, this,
                                        "SetValue");
@@ -68,6 +73,12 @@ void mtsDigitalOutput1394::SetupProvidedInterface(mtsInterfaceProvided * interfa
         interfaceProvided->AddCommandWrite(&mtsDigitalOutput1394::SetPWMDutyCycle, this,
                                            "SetPWMDutyCycle");
     }
+    interfaceProvided->AddCommandWrite(&mtsDigitalOutput1394::PlaySequence, this,
+                                       "PlaySequence");
+    interfaceProvided->AddCommandVoid(&mtsDigitalOutput1394::StopSequence, this,
+                                      "StopSequence");
+    interfaceProvided->AddCommandReadState(stateTable, this->mTriggerCount, "GetTriggerCount");
+    interfaceProvided->AddCommandReadState(stateTable, this->mTriggerTime, "GetTriggerTime");
 }
 
 void mtsDigitalOutput1394::CheckState(void)
@@ -79,13 +90,37 @@ void mtsDigitalOutput1394::CheckState(void)
 void mtsDigitalOutput1394::Configure(const osaDigitalOutput1394Configuration & config)
 {
     // Store configuration
-    mConfiguration = config;
+    mConfiguration.Name = config.Name;
     mName = config.Name;
+    Reconfigure(config);
+}
+
+void mtsDigitalOutput1394::Reconfigure(const osaDigitalOutput1394Configuration & config)
+{
+    mConfiguration.BoardID = config.BoardID;
+    mConfiguration.BitID = config.BitID;
+    mConfiguration.HighDuration = config.HighDuration;
+    mConfiguration.LowDuration = config.LowDuration;
+    mConfiguration.IsPWM = config.IsPWM;
+    mConfiguration.PWMFrequency = config.PWMFrequency;
+    mConfiguration.TriggerPeriod = config.TriggerPeriod;
     mBitID = config.BitID;
     mData->BitMask = 0x1 << mBitID;
 
     // Set the value
     mValue = false;
+
+    // Trigger, restarted on reconfiguration
+    mTriggerPeriod = config.TriggerPeriod;
+    if ((mTriggerPeriod > 0) && config.IsPWM) {
+        CMN_LOG_CLASS_INIT_WARNING << "Configure: " << mName
+                                   << ", trigger period ignored for PWM output" << std::endl;
+        mTriggerPeriod = 0;
+    }
+    mTriggerCycles = 0;
+    mTriggerValue = false;
+    mTriggerCount = 0;
+    mTriggerTime = 0.0;
 }
 
 void mtsDigitalOutput1394::SetBoard(AmpIO * board)
@@ -99,6 +134,22 @@ void mtsDigitalOutput1394::SetBoard(AmpIO * board)
                              mBoard->GetDoutCounts(mConfiguration.LowDuration));
 }
 
+void mtsDigitalOutput1394::SetBatch(osaDigitalOutputBatch1394 * batch)
+{
+    if (batch == 0) {
+        cmnThrow(this->Name() + ": invalid digital output batch pointer.");
+    }
+    mBatch = batch;
+}
+
+void mtsDigitalOutput1394::SetBoardSnapshot(const osaBoardSnapshot1394 * snapshot)
+{
+    if (snapshot == 0) {
+        cmnThrow(this->Name() + ": invalid board snapshot pointer.");
+    }
+    mBoardSnapshot = snapshot;
+}
+
 void mtsDigitalOutput1394::PollState(void)
 {
     // Get the new value
@@ -125,17 +176,90 @@ const bool & mtsDigitalOutput1394::Value(void) const
 
 void mtsDigitalOutput1394::SetValue(const bool & newValue)
 {
-    // read from the boards
-    mData->DigitalOutputBits = mBoard->GetDigitalOutput();
-    if (newValue) {
-        mData->DigitalOutputBits |= mData->BitMask;
+    mSequencer.Stop();
+    // written with all other changes for this board at the end of the cycle
+    mBatch->Request(mData->BitMask, newValue);
+}
+
+void mtsDigitalOutput1394::SetPWMDutyCycle(const double & dutyCycle)
+{
+    mSequencer.Stop();
+    WritePWMDutyCycle(dutyCycle);
+}
+
+void mtsDigitalOutput1394::PlaySequence(const osaDigitalOutputSequence1394 & sequence)
+{
+    std::string message;
+    if (!mSequencer.Start(sequence, message)) {
+        CMN_LOG_CLASS_RUN_ERROR << "PlaySequence: " << mName << ", " << message << std::endl;
+        if (mInterface) {
+            mInterface->SendError(mName + ": PlaySequence, " + message);
+        }
+    }
+}
+
+void mtsDigitalOutput1394::StopSequence(void)
+{
+    mSequencer.Stop();
+}
+
+void mtsDigitalOutput1394::StepSequence(void)
+{
+    if (!mSequencer.Playing()) {
+        return;
+    }
+    double value;
+    if (mSequencer.Step(mBoardSnapshot->TimestampSeconds, value)) {
+        WriteValue(value);
+    }
+}
+
+void mtsDigitalOutput1394::Hold(const bool value)
+{
+    mHeld = true;
+    mHeldValue = value;
+    mBatch->Request(mData->BitMask, value);
+}
+
+void mtsDigitalOutput1394::Release(const bool value)
+{
+    mHeld = false;
+    mBatch->Request(mData->BitMask, value);
+}
+
+void mtsDigitalOutput1394::StepHold(void)
+{
+    if (mHeld) {
+        mBatch->Request(mData->BitMask, mHeldValue);
+    }
+}
+
+void mtsDigitalOutput1394::StepTrigger(void)
+{
+    if (mTriggerPeriod <= 0) {
+        return;
+    }
+    ++mTriggerCycles;
+    if (mTriggerCycles < mTriggerPeriod) {
+        return;
+    }
+    mTriggerCycles = 0;
+    mTriggerValue = !mTriggerValue;
+    mBatch->Request(mData->BitMask, mTriggerValue);
+    mTriggerTime = mBoardSnapshot->FPGATime;
+    ++mTriggerCount;
+}
+
+void mtsDigitalOutput1394::WriteValue(const double value)
+{
+    if (mConfiguration.IsPWM) {
+        WritePWMDutyCycle(value);
     } else {
-        mData->DigitalOutputBits &= ~(mData->BitMask);
+        mBatch->Request(mData->BitMask, value > 0.5);
     }
-    mBoard->WriteDigitalOutput(0x0f, mData->DigitalOutputBits);
 }
 
-void mtsDigitalOutput1394::SetPWMDutyCycle(const double & dutyCycle)
+void mtsDigitalOutput1394::WritePWMDutyCycle(const double dutyCycle)
 {
     if ((dutyCycle > 0.0) && (dutyCycle < 1.0)) {
         mBoard->WritePWM(mBitID, mConfiguration.PWMFrequency, dutyCycle);
@@ -0,0 +1,347 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <limits>
+#include <sstream>
+
+#include <cisstCommon/cmnThrow.h>
+#include <cisstOSAbstraction/osaGetTime.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include <cisstMultiTask/mtsInterfaceProvided.h>
+
+#include <sawRobotIO1394/mtsMessageQueue1394.h>
+
+using namespace sawRobotIO1394;
+
+mtsMessageQueue1394::mtsMessageQueue1394(const cmnGenericObject & owner,
+                                         const size_t capacity):
+    OwnerServices(owner.Services())
+{
+    mMessages.SetCapacity(capacity);
+    mOutgoing.SetCapacity(capacity);
+    // reserve space so the IO thread never has to reallocate strings
+    for (auto & outgoing : mOutgoing.mElements) {
+        outgoing.Text.reserve(256);
+    }
+    mText.reserve(256);
+}
+
+mtsMessageQueue1394::~mtsMessageQueue1394()
+{
+    Stop();
+}
+
+size_t mtsMessageQueue1394::AddSource(const std::string & name,
+                                      mtsInterfaceProvided * interfaceProvided)
+{
+    if (mRunning) {
+        cmnThrow("mtsMessageQueue1394::AddSource: sources must be added before Start, can't add " + name);
+    }
+    Source source;
+    source.Name = name;
+    source.Interface = interfaceProvided;
+    mSources.push_back(source);
+    return mSources.size() - 1;
+}
+
+void mtsMessageQueue1394::SetMinimumInterval(const double & interval)
+{
+    mMinimumInterval = interval;
+}
+
+void mtsMessageQueue1394::Start(void)
+{
+    if (mRunning) {
+        return;
+    }
+    const size_t size = mSources.size() * osa1394::NUMBER_OF_FAULT_TYPES;
+    mTimeLastMessage.assign(size, std::numeric_limits<double>::lowest());
+    mSuppressed.assign(size, 0);
+    mRunning = true;
+    mThread.Create<mtsMessageQueue1394, void *>(this, &mtsMessageQueue1394::Run, nullptr, "IOMsg");
+}
+
+void mtsMessageQueue1394::Stop(void)
+{
+    if (!mRunning) {
+        return;
+    }
+    mRunning = false;
+    mThread.Wait();
+}
+
+bool mtsMessageQueue1394::Push(const osa1394::FaultType type,
+                               const size_t source,
+                               const double timestamp,
+                               const int index,
+                               const double value0,
+                               const double value1,
+                               const double value2)
+{
+    Message * message = mMessages.Back();
+    if (!message) {
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    message->Type = type;
+    message->Source = source;
+    message->Timestamp = timestamp;
+    message->Index = index;
+    message->Values[0] = value0;
+    message->Values[1] = value1;
+    message->Values[2] = value2;
+    mMessages.PushBack();
+    return true;
+}
+
+void mtsMessageQueue1394::Dispatch(const size_t maximumNumberOfMessages)
+{
+    for (size_t count = 0; count < maximumNumberOfMessages; ++count) {
+        Outgoing * outgoing = mOutgoing.Front();
+        if (!outgoing) {
+            return;
+        }
+        mtsInterfaceProvided * interfaceProvided = mSources[outgoing->Source].Interface;
+        switch (outgoing->Severity) {
+        case MESSAGE_ERROR:
+            interfaceProvided->SendError(outgoing->Text);
+            break;
+        case MESSAGE_WARNING:
+            interfaceProvided->SendWarning(outgoing->Text);
+            break;
+        default:
+            interfaceProvided->SendStatus(outgoing->Text);
+            break;
+        }
+        mOutgoing.PopFront();
+    }
+}
+
+size_t mtsMessageQueue1394::NumberOfDroppedMessages(void) const
+{
+    return mDropped.load(std::memory_order_relaxed);
+}
+
+mtsMessageQueue1394::SeverityType mtsMessageQueue1394::Severity(const osa1394::FaultType type)
+{
+    switch (type) {
+    case osa1394::CURRENT_VIOLATION:
+    case osa1394::BRAKE_CURRENT_VIOLATION:
+        return MESSAGE_LOG;
+    case osa1394::WATCHDOG_OK:
+    case osa1394::CALIBRATION_RELOADED:
+        return MESSAGE_STATUS;
+    case osa1394::TEMPERATURE_WARNING:
+    case osa1394::COMPUTE_TIME_EXCEEDED:
+        return MESSAGE_WARNING;
+    default:
+        return MESSAGE_ERROR;
+    }
+}
+
+void mtsMessageQueue1394::Format(const Message & message,
+                                 const std::string & sourceName,
+                                 std::string & text)
+{
+    std::stringstream result;
+    result.precision(4);
+    const unsigned long long mask = static_cast<unsigned long long>(message.Values[0]);
+    switch (message.Type) {
+    case osa1394::CURRENT_VIOLATION:
+        result << "CheckState: " << sourceName << ", actuator " << message.Index
+               << " power: " << message.Values[0] << " > limit: " << message.Values[1];
+        break;
+    case osa1394::BRAKE_CURRENT_VIOLATION:
+        result << "CheckState: " << sourceName << ", brake " << message.Index
+               << " power: " << message.Values[0] << " > limit: " << message.Values[1];
+        break;
+    case osa1394::CURRENT_VIOLATIONS_EXCEEDED:
+        result << "IO: " << sourceName << " too many consecutive current safety violations.  Power has been disabled.";
+        break;
+    case osa1394::SAFETY_AMP_DISABLE:
+        result << "IO: " << sourceName << " hardware current safety amp disable tripped";
+        break;
+    case osa1394::TEMPERATURE_WARNING:
+        result << "IO: " << sourceName << " controller measured temperature is " << message.Values[0]
+               << "ºC, warning threshold is set to " << message.Values[1] << "ºC";
+        break;
+    case osa1394::TEMPERATURE_ERROR:
+        result << "IO: " << sourceName << " controller measured temperature is " << message.Values[0]
+               << "ºC, error threshold is set to " << message.Values[1] << "ºC";
+        break;
+    case osa1394::MISSING_POT:
+        result << "IO: " << sourceName << " detected an unknow pot position for actuator " << message.Index
+               << ", make sure you're using the correct lookup configuration file or recalibrate your potentiometers";
+        break;
+    case osa1394::POT_ENCODER_INCONSISTENCY:
+        result << "IO: " << sourceName << ": inconsistency between encoders and potentiometers for actuator "
+               << message.Index << ", encoder: " << message.Values[0]
+               << ", potentiometer: " << message.Values[1]
+               << ", tolerance: " << message.Values[2];
+        break;
+    case osa1394::ENCODER_OVERFLOW:
+        result << "IO: " << sourceName << " encoder overflow detected on actuator(s)";
+        for (size_t bit = 0; bit < 64; ++bit) {
+            if (mask & (1ULL << bit)) {
+                result << " " << bit;
+            }
+        }
+        break;
+    case osa1394::POWER_UNEXPECTEDLY_OFF:
+        result << "IO: " << sourceName << " power is unexpectedly off";
+        break;
+    case osa1394::POWER_FAULT:
+        result << "IO: " << sourceName << " detected power fault";
+        break;
+    case osa1394::WATCHDOG_TIMEOUT:
+        result << "IO: " << sourceName << " watchdog triggered";
+        break;
+    case osa1394::WATCHDOG_OK:
+        result << "IO: " << sourceName << " watchdog ok";
+        break;
+    case osa1394::READ_ERROR:
+        result << "IO: " << sourceName << " port read error on board(s)";
+        for (size_t bit = 0; bit < 64; ++bit) {
+            if (mask & (1ULL << bit)) {
+                result << " " << bit;
+            }
+        }
+        break;
+    case osa1394::READ_ERRORS_REPEATED:
+        result << "IO: " << sourceName << " port read errors, occurred " << mask << " times";
+        break;
+    case osa1394::PERIOD_EXCEEDED:
+        result.precision(2);
+        result << sourceName << " IO: average period (" << message.Values[0]
+               << " ms) exceeded " << message.Values[1] << " time expected period ("
+               << message.Values[2] << " ms)";
+        break;
+    case osa1394::COMPUTE_TIME_EXCEEDED:
+        result.precision(2);
+        result << sourceName << " IO: average compute time (" << message.Values[0]
+               << " ms) exceeds expected period (" << message.Values[1] << " ms)";
+        break;
+    case osa1394::CALIBRATION_RELOADED:
+        result << "IO: " << sourceName << " new calibration applied";
+        break;
+    case osa1394::REFLEX_POWER_OFF:
+        result << "IO: " << sourceName << " powered off by reflex rule " << static_cast<int>(message.Values[0]);
+        break;
+    default:
+        result << "IO: " << sourceName << " " << osa1394::FaultTypeToString(message.Type);
+        break;
+    }
+    text = result.str();
+}
+
+void * mtsMessageQueue1394::Run(void * CMN_UNUSED(argument))
+{
+    while (mRunning) {
+        const double now = osaGetTime();
+        Message * message;
+        while ((message = mMessages.Front()) != nullptr) {
+            Process(*message, now);
+            mMessages.PopFront();
+        }
+        ReportSuppressed(now, false);
+        // ring was full at some point
+        const size_t dropped = mDropped.load(std::memory_order_relaxed);
+        if (dropped != mDroppedReported) {
+            CMN_LOG_CLASS_RUN_WARNING << "mtsMessageQueue1394: dropped " << (dropped - mDroppedReported)
+                                      << " message(s), ring is full" << std::endl;
+            mDroppedReported = dropped;
+        }
+        osaSleep(5.0 * cmn_ms);
+    }
+    // last messages, don't rate limit anymore
+    const double now = osaGetTime();
+    Message * message;
+    while ((message = mMessages.Front()) != nullptr) {
+        Process(*message, now);
+        mMessages.PopFront();
+    }
+    ReportSuppressed(now, true);
+    return nullptr;
+}
+
+void mtsMessageQueue1394::Process(const Message & message, const double now)
+{
+    if ((message.Source >= mSources.size())
+        || (message.Type >= osa1394::NUMBER_OF_FAULT_TYPES)) {
+        CMN_LOG_CLASS_RUN_ERROR << "mtsMessageQueue1394: invalid message source or type" << std::endl;
+        return;
+    }
+    const size_t slot = message.Source * osa1394::NUMBER_OF_FAULT_TYPES + message.Type;
+    if ((now - mTimeLastMessage[slot]) < mMinimumInterval) {
+        mSuppressed[slot]++;
+        return;
+    }
+    mTimeLastMessage[slot] = now;
+    Format(message, mSources[message.Source].Name, mText);
+    if (mSuppressed[slot] != 0) {
+        mText.append(" (" + std::to_string(mSuppressed[slot]) + " similar message(s) suppressed)");
+        mSuppressed[slot] = 0;
+    }
+    Forward(message.Source, Severity(message.Type), mText);
+}
+
+void mtsMessageQueue1394::ReportSuppressed(const double now, const bool all)
+{
+    for (size_t slot = 0; slot < mSuppressed.size(); ++slot) {
+        if ((mSuppressed[slot] != 0)
+            && (all || ((now - mTimeLastMessage[slot]) >= mMinimumInterval))) {
+            const size_t source = slot / osa1394::NUMBER_OF_FAULT_TYPES;
+            const osa1394::FaultType type = static_cast<osa1394::FaultType>(slot % osa1394::NUMBER_OF_FAULT_TYPES);
+            mText = "IO: " + mSources[source].Name + " " + std::to_string(mSuppressed[slot])
+                + " " + osa1394::FaultTypeToString(type) + " message(s) suppressed";
+            mSuppressed[slot] = 0;
+            mTimeLastMessage[slot] = now;
+            Forward(source, Severity(type), mText);
+        }
+    }
+}
+
+void mtsMessageQueue1394::Forward(const size_t source,
+                                  const SeverityType severity,
+                                  const std::string & text)
+{
+    // log only, interface provided would log anyway
+    if ((severity == MESSAGE_LOG) || !mSources[source].Interface || !mRunning) {
+        switch (severity) {
+        case MESSAGE_ERROR:
+            CMN_LOG_CLASS_RUN_ERROR << text << std::endl;
+            break;
+        case MESSAGE_WARNING:
+        case MESSAGE_LOG:
+            CMN_LOG_CLASS_RUN_WARNING << text << std::endl;
+            break;
+        default:
+            CMN_LOG_CLASS_RUN_VERBOSE << text << std::endl;
+            break;
+        }
+        return;
+    }
+    Outgoing * outgoing = mOutgoing.Back();
+    if (!outgoing) {
+        CMN_LOG_CLASS_RUN_ERROR << "mtsMessageQueue1394: outgoing ring is full, " << text << std::endl;
+        return;
+    }
+    outgoing->Source = source;
+    outgoing->Severity = severity;
+    outgoing->Text.assign(text);
+    mOutgoing.PushBack();
+}
@@ -16,6 +16,7 @@ http://www.cisst.org/cisst/license.txt.
 --- end cisst license ---
 */
 
+#include <algorithm>
 #include <cmath>
 #include <cctype>
 
@@ -31,6 +32,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <BasePort.h>
 
 #include <sawRobotIO1394/mtsRobot1394.h>
+#include <sawRobotIO1394/mtsMessageQueue1394.h>
 
 using namespace sawRobotIO1394;
 
@@ -295,6 +297,8 @@ void mtsRobot1394::SetupInterfaces(mtsInterfaceProvided * robotInterface)
     robotInterface->AddEventWrite(EventTriggers.WatchdogPeriod, "WatchdogPeriod", sawRobotIO1394::WatchdogTimeout);
     robotInterface->AddEventWrite(EventTriggers.BiasEncoder, "BiasEncoder", 0);
     robotInterface->AddEventWrite(EventTriggers.UsePotsForSafetyCheck, "UsePotsForSafetyCheck", false);
+    mFault.Robot = this->Name();
+    robotInterface->AddEventWrite(EventTriggers.Fault, "Fault", mFault);
 
     // from old actuator interface
     // todo: are these used anywhere?
@@ -306,13 +310,75 @@ void mtsRobot1394::SetupInterfaces(mtsInterfaceProvided * robotInterface)
                                             "AnalogInVoltsToPosSI", mPotVoltage, m_raw_pot_measured_js.Position());
 }
 
+void mtsRobot1394::SetMessageQueue(mtsMessageQueue1394 * messageQueue)
+{
+    mMessageQueue = messageQueue;
+    if (mMessageQueue) {
+        mMessageSource = mMessageQueue->AddSource(this->Name(), mInterface);
+    }
+}
+
+void mtsRobot1394::Report(const osa1394::FaultType type,
+                          const int index,
+                          const double value0,
+                          const double value1,
+                          const double value2)
+{
+    const double timestamp = mStateTableRead ? mStateTableRead->Tic : 0.0;
+    const mtsMessageQueue1394::SeverityType severity = mtsMessageQueue1394::Severity(type);
+
+    // structured event for faults and status changes, not for warnings only logged
+    if (severity != mtsMessageQueue1394::MESSAGE_LOG) {
+        mFault.Type = type;
+        if (type == osa1394::ENCODER_OVERFLOW) {
+            mFault.ActuatorMask = static_cast<unsigned int>(value0);
+        } else if ((index >= 0) && (index < 32)) {
+            mFault.ActuatorMask = (1u << index);
+        } else {
+            // no actuator or index can't be represented in the mask
+            mFault.ActuatorMask = 0;
+        }
+        mFault.Values.Assign(value0, value1, value2);
+        mFault.Timestamp = timestamp;
+        mFault.FPGATimestamp = mFPGATime;
+        EventTriggers.Fault(mFault);
+    }
+
+    if (mMessageQueue) {
+        mMessageQueue->Push(type, mMessageSource, timestamp, index, value0, value1, value2);
+        return;
+    }
+
+    // no message queue, i.e. robot used outside mtsRobotIO1394, format and send right away
+    mtsMessageQueue1394::Message message;
+    message.Type = type;
+    message.Source = 0;
+    message.Timestamp = timestamp;
+    message.Index = index;
+    message.Values[0] = value0;
+    message.Values[1] = value1;
+    message.Values[2] = value2;
+    std::string text;
+    mtsMessageQueue1394::Format(message, this->Name(), text);
+    if (!mInterface || (severity == mtsMessageQueue1394::MESSAGE_LOG)) {
+        CMN_LOG_CLASS_RUN_WARNING << text << std::endl;
+    } else if (severity == mtsMessageQueue1394::MESSAGE_ERROR) {
+        mInterface->SendError(text);
+    } else if (severity == mtsMessageQueue1394::MESSAGE_WARNING) {
+        mInterface->SendWarning(text);
+    } else {
+        mInterface->SendStatus(text);
+    }
+}
+
 void mtsRobot1394::Startup(void)
 {
     if (mHardwareVersion == osa1394::dRA1) {
         // do an encoder preload since we always use the lookup table
         SetEncoderPosition(vctDoubleVec(mNumberOfActuators, 0.0));
         // check the serial number
-        std::string calFileName = mUniqueBoards.begin()->second->ReadRobotSerialNumber();
+        // queried with all other board information, see CheckBoards
+        const std::string & calFileName = mBoardRobotSerialNumber;
         std::string expectedCalFileName =
             static_cast<char>(std::tolower(this->Name().at(0)))
             + this->SerialNumber() + ".cal";
@@ -358,8 +424,7 @@ void mtsRobot1394::GetSerialNumber(std::string & serialNumber) const {
 void mtsRobot1394::UsePotsForSafetyCheck(const bool & usePotsForSafetyCheck)
 {
     mUsePotsForSafetyCheck = usePotsForSafetyCheck;
-    mPotErrorDuration.SetAll(0.0);
-    mPotValid.SetAll(true);
+    mPotEncoderCheck.Reset();
     // trigger mts event
     EventTriggers.UsePotsForSafetyCheck(usePotsForSafetyCheck);
 }
@@ -496,17 +561,12 @@ void mtsRobot1394::Configure(const osaRobot1394Configuration & config)
     mActuatorBitsToCurrentOffsets.SetSize(mNumberOfActuators);
     mActuatorCurrentCommandLimits.SetSize(mNumberOfActuators);
     mActuatorCurrentFeedbackLimits.SetSize(mNumberOfActuators);
-    mPotToleranceLatency.SetSize(mNumberOfActuators);
-    mPotToleranceDistance.SetSize(mNumberOfActuators);
-    for (size_t i = 0; i < mNumberOfActuators; ++i) {
-        mPotToleranceLatency.at(i) = config.PotTolerances.at(i).Latency;
-        mPotToleranceDistance.at(i) = config.PotTolerances.at(i).Distance;
-    }
+    mPotEncoderCheck.Configure(config.PotTolerances);
     mPotCoupling.ForceAssign(config.PotCoupling.JointToActuatorPosition());
-    mPotErrorDuration.SetSize(mNumberOfActuators);
-    mPotValid.SetSize(mNumberOfActuators);
-    mPotErrorDuration.SetAll(0.0);
-    mPotValid.SetAll(true);
+    mPotCouplingKernel.Configure(mPotCoupling);
+    CMN_LOG_CLASS_INIT_VERBOSE << "Configure: " << mName << ", using "
+                               << osaPotCoupling1394::KernelToString(mPotCouplingKernel.Kernel())
+                               << " kernel for pot coupling" << std::endl;
     mUsePotsForSafetyCheck = false;
 
     // encoders
@@ -516,8 +576,12 @@ void mtsRobot1394::Configure(const osaRobot1394Configuration & config)
     // analog pots
     mBitsToVoltageScales.SetSize(mNumberOfActuators);
     mBitsToVoltageOffsets.SetSize(mNumberOfActuators);
-    // digital pots
-    mPotLookupTable.SetSize(mNumberOfActuators);
+    // digital pots, all tables packed together
+    size_t lookupTableSize = 0;
+    for (const auto & actuator : config.Actuators) {
+        lookupTableSize = std::max(lookupTableSize, actuator.Pot.LookupTable.size());
+    }
+    mPotLookupTable.SetSize(mNumberOfActuators, lookupTableSize);
     // all pots
     mSensorToPositionScales.SetSize(mNumberOfActuators);
     mSensorToPositionOffsets.SetSize(mNumberOfActuators);
@@ -532,32 +596,10 @@ void mtsRobot1394::Configure(const osaRobot1394Configuration & config)
 
         // Local references to the config properties
         const osaActuator1394Configuration & actuator = config.Actuators.at(i);
-        const osaDrive1394Configuration & drive = actuator.Drive;
-        const osaEncoder1394Configuration & encoder = actuator.Encoder;
         const osaPot1394Configuration & pot = actuator.Pot;
 
         m_configuration_js.Type().at(i) = actuator.JointType;
 
-        mEffortToCurrentScales.at(i)        = drive.EffortToCurrent.Scale;
-        mActuatorCurrentToBitsScales.at(i)  = drive.CurrentToBits.Scale;
-        mActuatorCurrentToBitsOffsets.at(i) = drive.CurrentToBits.Offset;
-        mActuatorBitsToCurrentScales.at(i)  = drive.BitsToCurrent.Scale;
-        mActuatorBitsToCurrentOffsets.at(i) = drive.BitsToCurrent.Offset;
-        mActuatorCurrentCommandLimits.at(i) = drive.CurrentCommandLimit;
-        m_configuration_js.PositionMin().at(i) = encoder.PositionLimitsSoft.Lower
-            * osaUnitToSIFactor(encoder.PositionLimitsSoft.Unit);
-        m_configuration_js.PositionMax().at(i) = encoder.PositionLimitsSoft.Upper
-            * osaUnitToSIFactor(encoder.PositionLimitsSoft.Unit);
-        m_configuration_js.EffortMin().at(i) = -drive.CurrentCommandLimit / drive.EffortToCurrent.Scale;
-        m_configuration_js.EffortMax().at(i) =  drive.CurrentCommandLimit / drive.EffortToCurrent.Scale;
-
-        // 120% of command current is in the acceptable range
-        // Add 50 mA for non motorized actuators due to a2d noise
-        mActuatorCurrentFeedbackLimits.at(i) = 1.2 * mActuatorCurrentCommandLimits.at(i) + (50.0 / 1000.0);
-
-        mBitsToPositionScales.at(i) = encoder.BitsToPosition.Scale * osaUnitToSIFactor(encoder.BitsToPosition.Unit);
-        mBitsToPositionOffsets.at(i) = encoder.BitsToPosition.Offset * osaUnitToSIFactor(encoder.BitsToPosition.Unit);
-
         // check which pots we have
         if (mPotType == 0) {
             mPotType = pot.Type;
@@ -569,13 +611,11 @@ void mtsRobot1394::Configure(const osaRobot1394Configuration & config)
             }
         }
 
-        if (pot.Type == 1) { // analog pots
-            mBitsToVoltageScales.at(i)  = pot.BitsToVoltage.Scale;
-            mBitsToVoltageOffsets.at(i) = pot.BitsToVoltage.Offset;
-            mSensorToPositionScales.at(i)  = pot.SensorToPosition.Scale  * osaUnitToSIFactor(pot.SensorToPosition.Unit);
-            mSensorToPositionOffsets.at(i) = pot.SensorToPosition.Offset * osaUnitToSIFactor(pot.SensorToPosition.Unit);
-        } else if (pot.Type == 2) { // digital pots
-            mPotLookupTable.at(i).ForceAssign(pot.LookupTable);
+        if (pot.Type == 2) { // digital pots, analog pots use scales and offsets
+            const size_t missing = mPotLookupTable.SetTable(i, pot.LookupTable,
+                                                           config.PotLookupTableInterpolation);
+            CMN_LOG_CLASS_INIT_VERBOSE << "Configure: " << this->mName << ", actuator " << i
+                                       << " has " << missing << " missing entries in pot lookup table" << std::endl;
         }
 
         // Initialize state vectors
@@ -618,30 +658,257 @@ void mtsRobot1394::Configure(const osaRobot1394Configuration & config)
         const osaActuator1394Configuration & actuator = config.Actuators.at(i);
 
         // Count number of brakes
+        if (actuator.Brake) {
+            // Initialize defaults
+            mBrakeCurrentCommand[currentBrake] = 0.0;
+            mBrakeCurrentFeedback[currentBrake] = 0.0;
+
+            currentBrake++;
+        }
+    }
+
+    // Scales, offsets and limits, same code used to reload calibration
+    CalibrationTables tables;
+    ComputeCalibration(config, tables);
+    ApplyCalibration(tables);
+}
+
+void mtsRobot1394::ComputeCalibration(const osaRobot1394Configuration & config,
+                                      CalibrationTables & tables) const
+{
+    const size_t numberOfActuators = config.Actuators.size();
+    tables.EffortToCurrentScales.SetSize(numberOfActuators);
+    tables.ActuatorCurrentToBitsScales.SetSize(numberOfActuators);
+    tables.ActuatorCurrentToBitsOffsets.SetSize(numberOfActuators);
+    tables.ActuatorBitsToCurrentScales.SetSize(numberOfActuators);
+    tables.ActuatorBitsToCurrentOffsets.SetSize(numberOfActuators);
+    tables.ActuatorCurrentCommandLimits.SetSize(numberOfActuators);
+    tables.ActuatorCurrentFeedbackLimits.SetSize(numberOfActuators);
+    tables.BitsToPositionScales.SetSize(numberOfActuators);
+    tables.BitsToPositionOffsets.SetSize(numberOfActuators);
+    tables.BitsToVoltageScales.SetSize(numberOfActuators);
+    tables.BitsToVoltageScales.SetAll(0.0);
+    tables.BitsToVoltageOffsets.SetSize(numberOfActuators);
+    tables.BitsToVoltageOffsets.SetAll(0.0);
+    tables.SensorToPositionScales.SetSize(numberOfActuators);
+    tables.SensorToPositionScales.SetAll(0.0);
+    tables.SensorToPositionOffsets.SetSize(numberOfActuators);
+    tables.SensorToPositionOffsets.SetAll(0.0);
+    tables.PositionMin.SetSize(numberOfActuators);
+    tables.PositionMax.SetSize(numberOfActuators);
+    tables.EffortMin.SetSize(numberOfActuators);
+    tables.EffortMax.SetSize(numberOfActuators);
+
+    size_t numberOfBrakes = 0;
+    for (const auto & actuator : config.Actuators) {
+        if (actuator.Brake) {
+            numberOfBrakes++;
+        }
+    }
+    tables.BrakeCurrentToBitsScales.SetSize(numberOfBrakes);
+    tables.BrakeCurrentToBitsOffsets.SetSize(numberOfBrakes);
+    tables.BrakeBitsToCurrentScales.SetSize(numberOfBrakes);
+    tables.BrakeBitsToCurrentOffsets.SetSize(numberOfBrakes);
+    tables.BrakeCurrentCommandLimits.SetSize(numberOfBrakes);
+    tables.BrakeCurrentFeedbackLimits.SetSize(numberOfBrakes);
+    tables.BrakeReleaseCurrent.SetSize(numberOfBrakes);
+    tables.BrakeReleaseTime.SetSize(numberOfBrakes);
+    tables.BrakeReleasedCurrent.SetSize(numberOfBrakes);
+    tables.BrakeEngagedCurrent.SetSize(numberOfBrakes);
+
+    tables.PotTolerances = config.PotTolerances;
+
+    size_t currentBrake = 0;
+    for (size_t i = 0; i < numberOfActuators; i++) {
+        const osaActuator1394Configuration & actuator = config.Actuators.at(i);
+        const osaDrive1394Configuration & drive = actuator.Drive;
+        const osaEncoder1394Configuration & encoder = actuator.Encoder;
+        const osaPot1394Configuration & pot = actuator.Pot;
+
+        tables.EffortToCurrentScales.at(i)        = drive.EffortToCurrent.Scale;
+        tables.ActuatorCurrentToBitsScales.at(i)  = drive.CurrentToBits.Scale;
+        tables.ActuatorCurrentToBitsOffsets.at(i) = drive.CurrentToBits.Offset;
+        tables.ActuatorBitsToCurrentScales.at(i)  = drive.BitsToCurrent.Scale;
+        tables.ActuatorBitsToCurrentOffsets.at(i) = drive.BitsToCurrent.Offset;
+        tables.ActuatorCurrentCommandLimits.at(i) = drive.CurrentCommandLimit;
+        tables.PositionMin.at(i) = encoder.PositionLimitsSoft.Lower
+            * osaUnitToSIFactor(encoder.PositionLimitsSoft.Unit);
+        tables.PositionMax.at(i) = encoder.PositionLimitsSoft.Upper
+            * osaUnitToSIFactor(encoder.PositionLimitsSoft.Unit);
+        tables.EffortMin.at(i) = -drive.CurrentCommandLimit / drive.EffortToCurrent.Scale;
+        tables.EffortMax.at(i) =  drive.CurrentCommandLimit / drive.EffortToCurrent.Scale;
+
+        // 120% of command current is in the acceptable range
+        // Add 50 mA for non motorized actuators due to a2d noise
+        tables.ActuatorCurrentFeedbackLimits.at(i) = 1.2 * drive.CurrentCommandLimit + (50.0 / 1000.0);
+
+        tables.BitsToPositionScales.at(i) = encoder.BitsToPosition.Scale * osaUnitToSIFactor(encoder.BitsToPosition.Unit);
+        tables.BitsToPositionOffsets.at(i) = encoder.BitsToPosition.Offset * osaUnitToSIFactor(encoder.BitsToPosition.Unit);
+
+        if (pot.Type == 1) { // analog pots
+            tables.BitsToVoltageScales.at(i)  = pot.BitsToVoltage.Scale;
+            tables.BitsToVoltageOffsets.at(i) = pot.BitsToVoltage.Offset;
+            tables.SensorToPositionScales.at(i)  = pot.SensorToPosition.Scale  * osaUnitToSIFactor(pot.SensorToPosition.Unit);
+            tables.SensorToPositionOffsets.at(i) = pot.SensorToPosition.Offset * osaUnitToSIFactor(pot.SensorToPosition.Unit);
+        }
+
         if (actuator.Brake) {
             const osaAnalogBrake1394Configuration * brake = actuator.Brake;
-            const osaDrive1394Configuration & drive = brake->Drive;
-            mBrakeCurrentToBitsScales[currentBrake]   = drive.CurrentToBits.Scale;
-            mBrakeCurrentToBitsOffsets[currentBrake]  = drive.CurrentToBits.Offset;
-            mBrakeBitsToCurrentScales[currentBrake]   = drive.BitsToCurrent.Scale;
-            mBrakeBitsToCurrentOffsets[currentBrake]  = drive.BitsToCurrent.Offset;
-            mBrakeCurrentCommandLimits[currentBrake]  = drive.CurrentCommandLimit;
+            const osaDrive1394Configuration & brakeDrive = brake->Drive;
+            tables.BrakeCurrentToBitsScales[currentBrake]   = brakeDrive.CurrentToBits.Scale;
+            tables.BrakeCurrentToBitsOffsets[currentBrake]  = brakeDrive.CurrentToBits.Offset;
+            tables.BrakeBitsToCurrentScales[currentBrake]   = brakeDrive.BitsToCurrent.Scale;
+            tables.BrakeBitsToCurrentOffsets[currentBrake]  = brakeDrive.BitsToCurrent.Offset;
+            tables.BrakeCurrentCommandLimits[currentBrake]  = brakeDrive.CurrentCommandLimit;
             // 120% of command current is in the acceptable range
             // Add 50 mA for a2d noise around 0
-            mBrakeCurrentFeedbackLimits[currentBrake] = 1.2 * mBrakeCurrentCommandLimits[currentBrake] + (50.0 / 1000.0);
+            tables.BrakeCurrentFeedbackLimits[currentBrake] = 1.2 * brakeDrive.CurrentCommandLimit + (50.0 / 1000.0);
 
-            mBrakeReleaseCurrent[currentBrake]  = brake->ReleaseCurrent;
-            mBrakeReleaseTime[currentBrake]     = brake->ReleaseTime;
-            mBrakeReleasedCurrent[currentBrake] = brake->ReleasedCurrent;
-            mBrakeEngagedCurrent[currentBrake]  = brake->EngagedCurrent;
+            tables.BrakeReleaseCurrent[currentBrake]  = brake->ReleaseCurrent;
+            tables.BrakeReleaseTime[currentBrake]     = brake->ReleaseTime;
+            tables.BrakeReleasedCurrent[currentBrake] = brake->ReleasedCurrent;
+            tables.BrakeEngagedCurrent[currentBrake]  = brake->EngagedCurrent;
+            currentBrake++;
+        }
+    }
+}
 
-            // Initialize defaults
-            mBrakeCurrentCommand[currentBrake] = 0.0;
-            mBrakeCurrentFeedback[currentBrake] = 0.0;
+void mtsRobot1394::ApplyCalibration(const CalibrationTables & tables)
+{
+    mEffortToCurrentScales.Assign(tables.EffortToCurrentScales);
+    mActuatorCurrentToBitsScales.Assign(tables.ActuatorCurrentToBitsScales);
+    mActuatorCurrentToBitsOffsets.Assign(tables.ActuatorCurrentToBitsOffsets);
+    mActuatorBitsToCurrentScales.Assign(tables.ActuatorBitsToCurrentScales);
+    mActuatorBitsToCurrentOffsets.Assign(tables.ActuatorBitsToCurrentOffsets);
+    mActuatorCurrentCommandLimits.Assign(tables.ActuatorCurrentCommandLimits);
+    mActuatorCurrentFeedbackLimits.Assign(tables.ActuatorCurrentFeedbackLimits);
+    mBitsToPositionScales.Assign(tables.BitsToPositionScales);
+    mBitsToPositionOffsets.Assign(tables.BitsToPositionOffsets);
+    mBitsToVoltageScales.Assign(tables.BitsToVoltageScales);
+    mBitsToVoltageOffsets.Assign(tables.BitsToVoltageOffsets);
+    mSensorToPositionScales.Assign(tables.SensorToPositionScales);
+    mSensorToPositionOffsets.Assign(tables.SensorToPositionOffsets);
+    m_configuration_js.PositionMin().Assign(tables.PositionMin);
+    m_configuration_js.PositionMax().Assign(tables.PositionMax);
+    m_configuration_js.EffortMin().Assign(tables.EffortMin);
+    m_configuration_js.EffortMax().Assign(tables.EffortMax);
+    mBrakeCurrentToBitsScales.Assign(tables.BrakeCurrentToBitsScales);
+    mBrakeCurrentToBitsOffsets.Assign(tables.BrakeCurrentToBitsOffsets);
+    mBrakeBitsToCurrentScales.Assign(tables.BrakeBitsToCurrentScales);
+    mBrakeBitsToCurrentOffsets.Assign(tables.BrakeBitsToCurrentOffsets);
+    mBrakeCurrentCommandLimits.Assign(tables.BrakeCurrentCommandLimits);
+    mBrakeCurrentFeedbackLimits.Assign(tables.BrakeCurrentFeedbackLimits);
+    mBrakeReleaseCurrent.Assign(tables.BrakeReleaseCurrent);
+    mBrakeReleaseTime.Assign(tables.BrakeReleaseTime);
+    mBrakeReleasedCurrent.Assign(tables.BrakeReleasedCurrent);
+    mBrakeEngagedCurrent.Assign(tables.BrakeEngagedCurrent);
+    mPotEncoderCheck.UpdateTolerances(tables.PotTolerances);
+}
+
+bool mtsRobot1394::CheckCalibration(const osaRobot1394Configuration & config,
+                                    const bool skipConfigurationCheck,
+                                    std::string & errorMessage) const
+{
+    const std::string prefix = "CheckCalibration: " + this->Name() + ", ";
+    if ((config.Actuators.size() != mNumberOfActuators)
+        || (config.HardwareVersion != mConfiguration.HardwareVersion)
+        || (config.OnlyIO != mConfiguration.OnlyIO)) {
+        errorMessage = prefix + "number of actuators, hardware version or robot type has changed";
+        return false;
+    }
+    if (config.PotTolerances.size() != mConfiguration.PotTolerances.size()) {
+        errorMessage = prefix + "number of pot tolerances has changed";
+        return false;
+    }
+    for (size_t i = 0; i < mNumberOfActuators; i++) {
+        const osaActuator1394Configuration & current = mConfiguration.Actuators.at(i);
+        const osaActuator1394Configuration & actuator = config.Actuators.at(i);
+        if ((actuator.BoardID != current.BoardID)
+            || (actuator.AxisID != current.AxisID)
+            || (actuator.JointType != current.JointType)
+            || (actuator.Pot.Type != current.Pot.Type)) {
+            errorMessage = prefix + "board, axis, joint type or pot type has changed for actuator " + std::to_string(i);
+            return false;
+        }
+        if ((actuator.Brake == nullptr) != (current.Brake == nullptr)) {
+            errorMessage = prefix + "brake added or removed for actuator " + std::to_string(i);
+            return false;
+        }
+        if (actuator.Brake
+            && ((actuator.Brake->BoardID != current.Brake->BoardID)
+                || (actuator.Brake->AxisID != current.Brake->AxisID))) {
+            errorMessage = prefix + "brake board or axis has changed for actuator " + std::to_string(i);
+            return false;
+        }
+        if (!mConfiguration.OnlyIO
+            && (actuator.Drive.EffortToCurrent.Scale == 0.0)) {
+            errorMessage = prefix + "effort to current scale can't be zero for actuator " + std::to_string(i);
+            return false;
+        }
+        if (config.PotTolerances.at(i).WindowSamples != mConfiguration.PotTolerances.at(i).WindowSamples) {
+            errorMessage = prefix + "pot tolerance window size has changed for actuator " + std::to_string(i);
+            return false;
+        }
+    }
 
-            currentBrake++;
+    if (skipConfigurationCheck) {
+        return true;
+    }
+    // units vs joint types, not checked by the JSON parser
+    if (!mConfiguration.OnlyIO) {
+        for (size_t i = 0; i < mNumberOfActuators; i++) {
+            const osaActuator1394Configuration & actuator = config.Actuators.at(i);
+            std::vector<std::string> units;
+            units.push_back(actuator.Encoder.BitsToPosition.Unit);
+            units.push_back(actuator.Encoder.PositionLimitsSoft.Unit);
+            if (actuator.Pot.Type == 1) {
+                units.push_back(actuator.Pot.SensorToPosition.Unit);
+            }
+            for (const auto & unit : units) {
+                if (((actuator.JointType == CMN_JOINT_REVOLUTE) && !osaUnitIsDistanceRevolute(unit))
+                    || ((actuator.JointType == CMN_JOINT_PRISMATIC) && !osaUnitIsDistancePrismatic(unit))) {
+                    errorMessage = prefix + "invalid unit \"" + unit + "\" for joint type of actuator " + std::to_string(i);
+                    return false;
+                }
+            }
+        }
+    }
+    // same as CheckConfiguration on the new offsets
+    if ((config.HardwareVersion != osa1394::dRA1)
+        && (mNumberOfActuators > 2)) {
+        const double offset0 = config.Actuators.at(0).Drive.CurrentToBits.Offset;
+        bool allEqual = true;
+        for (const auto & actuator : config.Actuators) {
+            allEqual &= (actuator.Drive.CurrentToBits.Offset == offset0);
         }
+        if (allEqual) {
+            errorMessage = prefix + "all currents to bits offsets are equal, please calibrate the current offsets";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool mtsRobot1394::StageCalibration(const osaRobot1394Configuration & config)
+{
+    // previous calibration not applied yet or another thread is staging
+    int expected = CALIBRATION_IDLE;
+    if (!mStagedCalibrationState.compare_exchange_strong(expected, CALIBRATION_STAGING)) {
+        return false;
+    }
+    ComputeCalibration(config, mStagedCalibration);
+    mStagedCalibrationState.store(CALIBRATION_READY, std::memory_order_release);
+    return true;
+}
+
+void mtsRobot1394::ApplyStagedCalibration(void)
+{
+    if (mStagedCalibrationState.load(std::memory_order_acquire) != CALIBRATION_READY) {
+        return;
     }
+    ApplyCalibration(mStagedCalibration);
+    mStagedCalibrationState.store(CALIBRATION_IDLE, std::memory_order_release);
+    Report(osa1394::CALIBRATION_RELOADED);
 }
 
 void mtsRobot1394::SetBoards(const std::vector<osaActuatorMapping> & actuatorBoards,
@@ -655,13 +922,16 @@ void mtsRobot1394::SetBoards(const std::vector<osaActuatorMapping> & actuatorBoa
         cmnThrow(this->Name() + ": number of brake boards different than the number of brakes.");
     }
 
+    // map only used to sort and remove duplicates
+    std::map<int, AmpIO *> uniqueBoards;
+
     for (size_t i = 0; i < mNumberOfActuators; i++) {
         // Store this board
         mActuatorInfo.at(i).Board = actuatorBoards.at(i).Board;
         mActuatorInfo.at(i).BoardID = actuatorBoards.at(i).BoardID;
         mActuatorInfo.at(i).Axis = actuatorBoards.at(i).Axis;
         // Construct a list of unique boards
-        mUniqueBoards[actuatorBoards.at(i).Board->GetBoardId()] = actuatorBoards.at(i).Board;
+        uniqueBoards[actuatorBoards.at(i).Board->GetBoardId()] = actuatorBoards.at(i).Board;
     }
 
     for (size_t i = 0; i < mNumberOfBrakes; i++) {
@@ -670,69 +940,88 @@ void mtsRobot1394::SetBoards(const std::vector<osaActuatorMapping> & actuatorBoa
         mBrakeInfo.at(i).BoardID = brakeBoards.at(i).BoardID;
         mBrakeInfo.at(i).Axis = brakeBoards.at(i).Axis;
         // Construct a list of unique boards
-        mUniqueBoards[brakeBoards.at(i).Board->GetBoardId()] = brakeBoards.at(i).Board;
+        uniqueBoards[brakeBoards.at(i).Board->GetBoardId()] = brakeBoards.at(i).Board;
+    }
+
+    // contiguous lists walked every cycle and on power commands
+    mUniqueBoards.clear();
+    mUniqueBoardIDs.clear();
+    for (const auto & board : uniqueBoards) {
+        mUniqueBoardIDs.push_back(board.first);
+        mUniqueBoards.push_back(board.second);
+    }
+}
+
+void mtsRobot1394::SetBoardSnapshots(const osaBoardSnapshot1394 * snapshots)
+{
+    mActuatorSnapshots.resize(mNumberOfActuators);
+    for (size_t i = 0; i < mNumberOfActuators; i++) {
+        mActuatorSnapshots.at(i) = &(snapshots[mActuatorInfo.at(i).BoardID]);
+    }
+    mBrakeSnapshots.resize(mNumberOfBrakes);
+    for (size_t i = 0; i < mNumberOfBrakes; i++) {
+        mBrakeSnapshots.at(i) = &(snapshots[mBrakeInfo.at(i).BoardID]);
     }
+    mUniqueSnapshots.clear();
+    for (const auto boardID : mUniqueBoardIDs) {
+        mUniqueSnapshots.push_back(&(snapshots[boardID]));
+    }
+}
 
+void mtsRobot1394::CheckBoards(const std::map<int, osaBoardInfo1394> & boardInfo)
+{
     mLowestFirmWareVersion = 999999;
     mHighestFirmWareVersion = 0;
-    size_t boardCounter = 0;
-    for (auto board = mUniqueBoards.begin();
-         board != mUniqueBoards.end();
-         ++board, ++boardCounter) {
+    for (size_t boardCounter = 0;
+         boardCounter < mUniqueBoards.size();
+         ++boardCounter) {
+        AmpIO * board = mUniqueBoards[boardCounter];
+        const auto info = boardInfo.find(mUniqueBoardIDs[boardCounter]);
+        if (info == boardInfo.end()) {
+            cmnThrow(this->Name() + ": CheckBoards, board information missing, make sure all boards have been queried.");
+        }
         // check the hardware version vs version specified in configuration file
-        const auto hardwareVersion = board->second->GetHardwareVersion();
+        const auto hardwareVersion = info->second.HardwareVersion;
         if (!((hardwareVersion == QLA1_String && mHardwareVersion == osa1394::QLA1)
               || (hardwareVersion == DQLA_String && mHardwareVersion == osa1394::DQLA)
               || (hardwareVersion == dRA1_String && mHardwareVersion == osa1394::dRA1))) {
             if (hardwareVersion == BCFG_String) {
-                CMN_LOG_CLASS_INIT_ERROR << "SetBoards: " << this->mName
+                CMN_LOG_CLASS_INIT_ERROR << "CheckBoards: " << this->mName
                                          << ", hardware version query reported BCFG (boot configuration)." << std::endl
                                          << "Maybe you just need to wait for the controller to boot or forgot to insert the SD with a valid firmware." << std::endl;
             } else {
-                CMN_LOG_CLASS_INIT_ERROR << "SetBoards: " << this->mName
+                CMN_LOG_CLASS_INIT_ERROR << "CheckBoards: " << this->mName
                                          << ", hardware version doesn't match value from configuration file for board: " << boardCounter
-                                         << ", Id: " << static_cast<int>(board->second->GetBoardId())
-                                         << ".  Hardware found: " << board->second->GetHardwareVersionString()
+                                         << ", Id: " << static_cast<int>(board->GetBoardId())
+                                         << ".  Hardware found: " << board->GetHardwareVersionString()
                                          << ".  Configuration file value: " << osa1394::HardwareTypeToString(mHardwareVersion) << std::endl;
             }
             exit(EXIT_FAILURE);
         }
         // then get firmware
-        uint32_t fversion = board->second->GetFirmwareVersion();
+        const uint32_t fversion = info->second.FirmwareVersion;
         if (fversion == 0) {
-            CMN_LOG_CLASS_INIT_ERROR << "SetBoards: " << this->mName
+            CMN_LOG_CLASS_INIT_ERROR << "CheckBoards: " << this->mName
                                      << ", unable to get firmware version for board: " << boardCounter
-                                     << ", Id: " << static_cast<int>(board->second->GetBoardId())
+                                     << ", Id: " << static_cast<int>(board->GetBoardId())
                                      << ".  Make sure the controller is powered and connected" << std::endl;
             exit(EXIT_FAILURE);
         }
-        std::string serialQLA;
-        if (mHardwareVersion == osa1394::DQLA) {
-            serialQLA = board->second->GetQLASerialNumber(1) +
-                ", " +  board->second->GetQLASerialNumber(2);
-        }
-        else {
-            serialQLA = board->second->GetQLASerialNumber();
-        }
-        if (serialQLA.empty()) {
-            serialQLA = "unknown";
-        }
-        std::string serialFPGA = board->second->GetFPGASerialNumber();
-        if (serialFPGA.empty()) {
-            serialFPGA = "unknown";
-        }
         if (fversion < mLowestFirmWareVersion) {
             mLowestFirmWareVersion = fversion;
         }
         if (fversion > mHighestFirmWareVersion) {
             mHighestFirmWareVersion = fversion;
         }
-        CMN_LOG_CLASS_INIT_WARNING << "SetBoards: " << this->mName
+        if (boardCounter == 0) {
+            mBoardRobotSerialNumber = info->second.RobotSerialNumber;
+        }
+        CMN_LOG_CLASS_INIT_WARNING << "CheckBoards: " << this->mName
                                    << ", board: " << boardCounter
-                                   << ", Id: " << static_cast<int>(board->second->GetBoardId())
+                                   << ", Id: " << static_cast<int>(board->GetBoardId())
                                    << ", firmware: " << fversion
-                                   << ", FPGA serial: " << serialFPGA
-                                   << ", QLA serial: " << serialQLA
+                                   << ", FPGA serial: " << info->second.FPGASerialNumber
+                                   << ", QLA serial: " << info->second.QLASerialNumber
                                    << std::endl;
     }
 }
@@ -765,14 +1054,14 @@ void mtsRobot1394::PollValidity(void)
     mWatchdogTimeoutStatus = false;
 
     // Get status from boards
-    for (auto & board : mUniqueBoards) {
-        mValid &= board.second->ValidRead();
-        mPowerEnable &= board.second->GetPowerEnable();
-        mPowerStatus &= board.second->GetPowerStatus();
-        mPowerFault |= board.second->GetPowerFault();
-        mSafetyRelay &= board.second->GetSafetyRelay();
-        mSafetyRelayStatus &= board.second->GetSafetyRelayStatus();
-        mWatchdogTimeoutStatus |= board.second->GetWatchdogTimeoutStatus();
+    for (const auto snapshot : mUniqueSnapshots) {
+        mValid &= snapshot->Valid;
+        mPowerEnable &= snapshot->PowerEnable;
+        mPowerStatus &= snapshot->PowerStatus;
+        mPowerFault |= snapshot->PowerFault;
+        mSafetyRelay &= snapshot->SafetyRelay;
+        mSafetyRelayStatus &= snapshot->SafetyRelayStatus;
+        mWatchdogTimeoutStatus |= snapshot->WatchdogTimeoutStatus;
     }
 
     mFullyPowered = mPowerStatus && !mPowerFault && mSafetyRelay && mSafetyRelayStatus && !mWatchdogTimeoutStatus;
@@ -780,19 +1069,18 @@ void mtsRobot1394::PollValidity(void)
     if (!mValid) {
         if (mInvalidReadCounter == 0) {
             mInvalidReadCounter++;
-            std::stringstream message;
-            message << this->Name() << ": port read error on board(s) ";
-            for (auto & board : mUniqueBoards) {
-                if (!board.second->ValidRead()) {
-                    message << static_cast<int>(board.second->GetBoardId()) << " ";
+            unsigned int boardsMask = 0;
+            for (size_t index = 0; index < mUniqueSnapshots.size(); ++index) {
+                if (!mUniqueSnapshots[index]->Valid) {
+                    boardsMask |= (1 << mUniqueBoardIDs[index]);
                 }
             }
-            cmnThrow(message.str());
+            Report(osa1394::READ_ERROR, -1, boardsMask);
         } else {
             mInvalidReadCounter++;
             if (mInvalidReadCounter == 10000) {
                 mInvalidReadCounter = 0;
-                cmnThrow(this->Name() + ": port read errors, occurred 10,000 times");
+                Report(osa1394::READ_ERRORS_REPEATED, -1, 10000);
             }
         }
     } else {
@@ -809,8 +1097,9 @@ void mtsRobot1394::PollState(void)
 
         if (!board || (axis < 0)) continue; // We probably don't need this check any more
 
-        mActuatorTimestamp[i] = board->GetTimestampSeconds();
-        mDigitalInputs[i] = board->GetDigitalInput();
+        const osaBoardSnapshot1394 * snapshot = mActuatorSnapshots[i];
+        mActuatorTimestamp[i] = snapshot->TimestampSeconds;
+        mDigitalInputs[i] = snapshot->DigitalInput;
 
         // vectors of bits
         if (!mConfiguration.OnlyIO) {
@@ -834,8 +1123,7 @@ void mtsRobot1394::PollState(void)
         mActuatorAmpStatus[i] = board->GetAmpStatus(axis);
 
         // first temperature corresponds to first 2 actuators, second to last 2
-        // board reports temperature in celsius * 2
-        mActuatorTemperature[i] = (board->GetAmpTemperature(axis / 2)) / 2.0;
+        mActuatorTemperature[i] = snapshot->AmpTemperature[axis / 2];
     }
 
     for (size_t i = 0; i < mNumberOfBrakes; i++) {
@@ -844,16 +1132,22 @@ void mtsRobot1394::PollState(void)
 
         if (!board || (axis < 0)) continue; // We probably don't need this check any more
 
-        mBrakeTimestamp[i] = board->GetTimestampSeconds();
+        const osaBoardSnapshot1394 * snapshot = mBrakeSnapshots[i];
+        mBrakeTimestamp[i] = snapshot->TimestampSeconds;
         mBrakeCurrentBitsFeedback[i] = board->GetMotorCurrent(axis);
         mBrakeAmpEnable[i] = board->GetAmpEnable(axis);
         mBrakeAmpStatus[i] = board->GetAmpStatus(axis);
 
         // first temperature corresponds to first 2 brakes, second to last 2
-        // board reports temperature in celsius * 2
-        mBrakeTemperature[i] = (board->GetAmpTemperature(axis / 2)) / 2.0;
+        mBrakeTemperature[i] = snapshot->AmpTemperature[axis / 2];
     }
 
+    // cumulated FPGA time, used to timestamp faults
+    if (!mActuatorTimestamp.empty()) {
+        mFPGATime += mActuatorTimestamp[0];
+    } else if (!mBrakeTimestamp.empty()) {
+        mFPGATime += mBrakeTimestamp[0];
+    }
 }
 
 void mtsRobot1394::ConvertState(void)
@@ -966,25 +1260,12 @@ void mtsRobot1394::ConvertState(void)
     } else if (mPotType == 2) {
         // dummy voltages
         mPotVoltage.Assign(mPotBits);
-        auto raw = mPotBits.begin();
-        const auto end = mPotBits.end();
-        auto table = mPotLookupTable.begin();
-        auto si = m_raw_pot_measured_js.Position().begin();
-        for (; raw != end;
-             ++raw,
-                 ++table,
-                 ++si) {
-            // look up in table
-            *si = (*table).at(*raw);
-        }
+        // look up in table
+        mPotLookupTable.Lookup(mPotBits, m_raw_pot_measured_js.Position());
     }
 
     // Pots, convert to actuator space if the coupling matrix is defined
-    if (mPotCoupling.size() != 0) {
-        m_pot_measured_js.Position().ProductOf(mPotCoupling, m_raw_pot_measured_js.Position());
-    } else {
-        m_pot_measured_js.Position().Assign(m_raw_pot_measured_js.Position());
-    }
+    mPotCouplingKernel.Apply(m_raw_pot_measured_js.Position(), m_pot_measured_js.Position());
 }
 
 void mtsRobot1394::CheckState(void)
@@ -1026,9 +1307,7 @@ void mtsRobot1394::CheckState(void)
                 }
             }
             if (fabs(*feedback) >= actual_limit) {
-                CMN_LOG_CLASS_RUN_WARNING << "CheckState: " << this->mName << ", actuator " << index
-                                          << " power: " << *feedback
-                                          << " > limit: " << actual_limit << std::endl;
+                Report(osa1394::CURRENT_VIOLATION, index, *feedback, actual_limit);
                 currentSafetyViolation = true;
             }
         }
@@ -1044,9 +1323,7 @@ void mtsRobot1394::CheckState(void)
                  ++limit,
                  ++index) {
             if (fabs(*feedback) >= *limit) {
-                CMN_LOG_CLASS_RUN_WARNING << "CheckState: " << this->mName << ", brake " << index
-                                          << " power: " << *feedback
-                                          << " > limit: " << *limit << std::endl;
+                Report(osa1394::BRAKE_CURRENT_VIOLATION, index, *feedback, *limit);
                 currentSafetyViolation = true;
             }
         }
@@ -1060,22 +1337,23 @@ void mtsRobot1394::CheckState(void)
 
     if (mCurrentSafetyViolationsCounter > mCurrentSafetyViolationsMaximum) {
         this->PowerOffSequenceOnError(false /* do no open safety relays */);
-        cmnThrow(this->Name() + ": too many consecutive current safety violations.  Power has been disabled.");
+        Report(osa1394::CURRENT_VIOLATIONS_EXCEEDED);
+        return;
     }
 
     // check safety amp disable
     bool newSafetyAmpDisabled = false;
-    for (auto & board : mUniqueBoards) {
-        uint32_t safetyAmpDisable = board.second->GetSafetyAmpDisable();
-        if (safetyAmpDisable) {
+    for (const auto snapshot : mUniqueSnapshots) {
+        if (snapshot->SafetyAmpDisable) {
             newSafetyAmpDisabled = true;
         }
     }
     if (newSafetyAmpDisabled && !mSafetyAmpDisabled) {
-        // update status - this needs to be here, throw will interrupt execution...
+        // update status - this needs to be here, return will interrupt execution...
         mSafetyAmpDisabled = newSafetyAmpDisabled;
-        // throw only if this is new
-        cmnThrow(this->Name() + ": hardware current safety amp disable tripped." + mActuatorTimestamp.ToString());
+        // report only if this is new
+        Report(osa1394::SAFETY_AMP_DISABLE);
+        return;
     } else {
         // update status
         mSafetyAmpDisabled = newSafetyAmpDisabled;
@@ -1086,6 +1364,7 @@ void mtsRobot1394::CheckState(void)
         bool temperatureError = false;
         bool temperatureWarning = false;
         double temperatureTrigger = 0.0;
+        int temperatureIndex = -1;
         // actuators
         {
             const vctDoubleVec::const_iterator end = mActuatorTemperature.end();
@@ -1095,18 +1374,14 @@ void mtsRobot1394::CheckState(void)
                  ++temperature,
                      ++index) {
                 if (*temperature > sawRobotIO1394::TemperatureErrorThreshold) {
-                    CMN_LOG_CLASS_RUN_ERROR << "CheckState: " << this->mName << ", actuator " << index
-                                            << " temperature: " << *temperature
-                                            << " greater than error threshold: " << sawRobotIO1394::TemperatureErrorThreshold << std::endl;
                     temperatureError = true;
                     temperatureTrigger = *temperature;
+                    temperatureIndex = static_cast<int>(index);
                 } else {
                     if (*temperature > sawRobotIO1394::TemperatureWarningThreshold) {
-                        CMN_LOG_CLASS_RUN_DEBUG << "CheckState: " << this->mName << ", actuator " << index
-                                                << " temperature: " << *temperature
-                                                << " greater than warning threshold: " << sawRobotIO1394::TemperatureWarningThreshold << std::endl;
                         temperatureWarning = true;
                         temperatureTrigger = *temperature;
+                        temperatureIndex = static_cast<int>(index);
                     }
                 }
             }
@@ -1120,18 +1395,14 @@ void mtsRobot1394::CheckState(void)
                  ++temperature,
                      ++index) {
                 if (*temperature > sawRobotIO1394::TemperatureErrorThreshold) {
-                    CMN_LOG_CLASS_RUN_ERROR << "CheckState: " << this->mName << ", brake " << index
-                                            << " temperature: " << *temperature
-                                            << " greater than error threshold: " << sawRobotIO1394::TemperatureErrorThreshold << std::endl;
                     temperatureError = true;
                     temperatureTrigger = *temperature;
+                    temperatureIndex = static_cast<int>(index);
                 } else {
                     if (*temperature > sawRobotIO1394::TemperatureWarningThreshold) {
-                        CMN_LOG_CLASS_RUN_DEBUG << "CheckState: " << this->mName << ", brake " << index
-                                                << " temperature: " << *temperature
-                                                << " greater than warning threshold: " << sawRobotIO1394::TemperatureWarningThreshold << std::endl;
                         temperatureWarning = true;
                         temperatureTrigger = *temperature;
+                        temperatureIndex = static_cast<int>(index);
                     }
                 }
             }
@@ -1139,16 +1410,12 @@ void mtsRobot1394::CheckState(void)
 
         if (temperatureError) {
             this->PowerOffSequenceOnError(false /* do not open safety relays */);
-            std::stringstream message;
-            message << "IO: " << this->Name() << " controller measured temperature is " << temperatureTrigger
-                    << "ºC, error threshold is set to " << sawRobotIO1394::TemperatureErrorThreshold << "ºC";
-            mInterface->SendError(message.str());
+            Report(osa1394::TEMPERATURE_ERROR, temperatureIndex,
+                   temperatureTrigger, sawRobotIO1394::TemperatureErrorThreshold);
         } else if (temperatureWarning) {
             if (mTimeLastTemperatureWarning >= sawRobotIO1394::TimeBetweenTemperatureWarnings) {
-                std::stringstream message;
-                message << "IO: " << this->Name() << " controller measured temperature is " << temperatureTrigger
-                        << "ºC, warning threshold is set to " << sawRobotIO1394::TemperatureWarningThreshold << "ºC";
-                mInterface->SendWarning(message.str());
+                Report(osa1394::TEMPERATURE_WARNING, temperatureIndex,
+                       temperatureTrigger, sawRobotIO1394::TemperatureWarningThreshold);
                 mTimeLastTemperatureWarning = 0.0;
             }
             double time = 0.0;
@@ -1185,17 +1452,22 @@ void mtsRobot1394::CheckState(void)
 
     // For dRAC based arms, make sure the pots value are meaningfull
     if (mHardwareVersion == osa1394::dRA1 && !mCalibrationMode) {
-        bool foundMissingPot = false;
-        for (const auto & potValue : m_pot_measured_js.Position()) {
-            if (mtsRobot1394::IsMissingPotValue(potValue)) {
-                foundMissingPot = true;
+        // bitmap of missing entries updated during lookup
+        bool foundMissingPot = (mPotType == 2) && mPotLookupTable.AnyMissing();
+        int missingPotIndex = -1;
+        if (foundMissingPot) {
+            const vctBoolVec & missing = mPotLookupTable.Missing();
+            for (size_t index = 0; index < missing.size(); ++index) {
+                if (missing[index]) {
+                    missingPotIndex = static_cast<int>(index);
+                }
             }
         }
         if (foundMissingPot) {
             this->PowerOffSequenceOnError();
             // send error message without flooding the UI
             if (mTimeLastPotentiometerMissingError >= sawRobotIO1394::TimeBetweenPotentiometerMissingErrors) {
-                mInterface->SendError("IO: " + this->Name() + " detected an unknow pot position, make sure you're using the correct lookup configuration file or recalibrate your potentiometers");
+                Report(osa1394::MISSING_POT, missingPotIndex);
                 mTimeLastPotentiometerMissingError = 0.0;
             }
             double time = 0.0;
@@ -1211,87 +1483,35 @@ void mtsRobot1394::CheckState(void)
         }
     }
 
-    // Check if encoders and potentiometers agree
+    // Check if encoders and potentiometers agree, both in actuator space
     if (mUsePotsForSafetyCheck) {
-        vctDynamicVectorRef<double> encoderRef;
-        // todo: multiply pots by PotCoupling so everything is in actuator space
-        encoderRef.SetRef(m_measured_js.Position());
-
-        bool statusChanged = false;
-        bool error = false;
-        vctDoubleVec::const_iterator pot = m_pot_measured_js.Position().begin();
-        vctDynamicVectorRef<double>::const_iterator enc = encoderRef.begin();
-        const vctDoubleVec::const_iterator potEnd = m_pot_measured_js.Position().end();
-        vctDoubleVec::const_iterator potLatency = mPotToleranceLatency.begin();
-        vctDoubleVec::const_iterator potError = mPotToleranceDistance.begin();
-        vctDoubleVec::const_iterator potTimestamp = mActuatorTimestamp.begin(); // this is a bit approximative when there's coupling
-        vctDoubleVec::iterator potDuration = mPotErrorDuration.begin();
-        vctBoolVec::iterator potValid = mPotValid.begin();
-
-        for (;
-             pot != potEnd;
-             ++pot,
-                 ++enc,
-                 ++potLatency,
-                 ++potError,
-                 ++potTimestamp,
-                 ++potDuration,
-                 ++potValid) {
-            // if tolerance set to 0, disable check for that joint
-            if (*potError == 0.0) {
-                *potValid = true;
-            } else {
-                // check for error
-                double delta = std::abs(*pot - *enc);
-                if (delta > *potError) {
-                    *potDuration += *potTimestamp;
-                    // check how long have we been off
-                    if (*potDuration > *potLatency) {
-                        // now we have a problem,
-                        this->PowerOffSequenceOnError(false); // don't open safety relays
-                        // maybe it's not new, used for reporting
-                        if (*potValid) {
-                            // this is new
-                            statusChanged = true;
-                            error = true;
-                            *potValid = false;
-                        }
-                    }
-                } else {
-                    // back to normal, reset status if needed
-                    *potDuration = 0.0;
-                    if (! *potValid) {
-                        statusChanged = true;
-                        *potValid = true;
-                    }
+        if (mPotEncoderCheck.Check(m_pot_measured_js.Position(),
+                                   m_measured_js.Position(),
+                                   mActuatorTimestamp)) {
+            const vctBoolVec & newlyInvalid = mPotEncoderCheck.NewlyInvalid();
+            bool error = false;
+            for (size_t index = 0; index < mNumberOfActuators; ++index) {
+                if (newlyInvalid[index]) {
+                    error = true;
+                    Report(osa1394::POT_ENCODER_INCONSISTENCY, static_cast<int>(index),
+                           m_measured_js.Position().Element(index),
+                           m_pot_measured_js.Position().Element(index),
+                           mPotEncoderCheck.Distance().Element(index));
                 }
             }
-        }
-        // if status has changed
-        if (statusChanged) {
             if (error) {
                 this->PowerOffSequenceOnError(false /* do not open safety relays */);
-                std::string errorMessage = "IO: " + this->Name() + ": inconsistency between encoders and potentiometers";
-                std::string warningMessage = errorMessage + "\nencoders:\n";
-                warningMessage.append(encoderRef.ToString());
-                warningMessage.append("\npotentiomers:\n");
-                warningMessage.append(m_pot_measured_js.Position().ToString());
-                warningMessage.append("\ntolerance distance:\n");
-                warningMessage.append(mPotToleranceDistance.ToString());
-                warningMessage.append("\nvalid pots:\n");
-                warningMessage.append(mPotValid.ToString());
-                warningMessage.append("\ntolerance latency:\n");
-                warningMessage.append(mPotToleranceLatency.ToString());
-                warningMessage.append("\nerror duration:\n");
-                warningMessage.append(mPotErrorDuration.ToString());
-                mInterface->SendWarning(warningMessage);
-                cmnThrow(errorMessage);
+                return;
             } else {
                 CMN_LOG_CLASS_RUN_VERBOSE << "IO: " << this->Name()
                                           << ": check between encoders and potentiomenters, recovery.  Valid pots:" << std::endl
-                                          << mPotValid << std::endl;
+                                          << mPotEncoderCheck.Valid() << std::endl;
             }
         }
+        // keep power off as long as pots and encoders disagree
+        if (!mPotEncoderCheck.AllValid()) {
+            this->PowerOffSequenceOnError(false /* do not open safety relays */);
+        }
     }
 
     // Check for encoder overflow
@@ -1300,13 +1520,16 @@ void mtsRobot1394::CheckState(void)
         this->SetEncoderPosition(vctDoubleVec(mNumberOfActuators, 0.0));
         if (mEncoderOverflow.NotEqual(mPreviousEncoderOverflow)) {
             mPreviousEncoderOverflow.Assign(mEncoderOverflow);
-            std::string errorMessage = this->Name() + ": encoder overflow detected: ";
-            errorMessage.append(mEncoderOverflow.ToString());
+            unsigned long long overflowMask = 0;
+            for (size_t index = 0; index < mEncoderOverflow.size(); ++index) {
+                if (mEncoderOverflow[index]) {
+                    overflowMask |= (1ULL << index);
+                }
+            }
+            Report(osa1394::ENCODER_OVERFLOW, -1, static_cast<double>(overflowMask));
             // if we have already performed encoder calibration, this is really bad
             if (CalibrateEncoderOffsets.Performed) {
-                cmnThrow(errorMessage);
-            } else {
-                mInterface->SendError("IO: " + this->Name() + " encoder overflow detected");
+                return;
             }
         }
     }
@@ -1324,7 +1547,7 @@ void mtsRobot1394::CheckState(void)
             // give some time to power, if greater then it's an issue
             if ((mStateTableRead->Tic - mPoweringStartTime) > sawRobotIO1394::MaximumTimeToPower) {
                 this->PowerOffSequenceOnError(false /* do not open safety relays */);
-                mInterface->SendError("IO: " + this->Name() + " power is unexpectedly off");
+                Report(osa1394::POWER_UNEXPECTEDLY_OFF);
             }
         }
     }
@@ -1335,7 +1558,7 @@ void mtsRobot1394::CheckState(void)
             // give some time to power, if greater then it's an issue
             if ((mStateTableRead->Tic - mPoweringStartTime) > sawRobotIO1394::MaximumTimeForMVGood) {
                 this->PowerOffSequenceOnError(false /* do not open safety relays */);
-                mInterface->SendError("IO: " + this->Name() + " detected power fault");
+                Report(osa1394::POWER_FAULT);
             }
         }
     }
@@ -1344,9 +1567,9 @@ void mtsRobot1394::CheckState(void)
         EventTriggers.WatchdogTimeoutStatus(mWatchdogTimeoutStatus);
         if (mWatchdogTimeoutStatus) {
             this->PowerOffSequenceOnError(false /* do not open safety relays */);
-            mInterface->SendError("IO: " + this->Name() + " watchdog triggered");
+            Report(osa1394::WATCHDOG_TIMEOUT);
         } else {
-            mInterface->SendStatus("IO: " + this->Name() + " watchdog ok");
+            Report(osa1394::WATCHDOG_OK);
         }
     }
 
@@ -1431,8 +1654,8 @@ void mtsRobot1394::PowerOffSequence(const bool & openSafetyRelays)
     mUserExpectsPower = false;
     // write to boards directly
     // disable all axes
-    for (auto & board : mUniqueBoards) {
-        board.second->WriteAmpEnable(0x0f, 0x00);
+    for (auto board : mUniqueBoards) {
+        board->WriteAmpEnable(0x0f, 0x00);
     }
 
     // disable all boards
@@ -1454,7 +1677,7 @@ void mtsRobot1394::Explain(void)
 {
     for (auto board : mUniqueBoards) {
         CMN_LOG_CLASS_RUN_ERROR << "Explain: " << this->Name()
-                                << " - " << board.second->ExplainSiFault() << std::endl;
+                                << " - " << board->ExplainSiFault() << std::endl;
     }
 }
 
@@ -1467,7 +1690,7 @@ void mtsRobot1394::set_LED_pattern(const prmInputData & pattern)
         return;
     }
     for (auto board : mUniqueBoards) {
-        board.second->WriteRobotLED(static_cast<uint32_t>(pattern.AnalogInputs().at(0)),
+        board->WriteRobotLED(static_cast<uint32_t>(pattern.AnalogInputs().at(0)),
                                     static_cast<uint32_t>(pattern.AnalogInputs().at(1)),
                                     pattern.DigitalInputs().at(0),
                                     pattern.DigitalInputs().at(1));
@@ -1478,16 +1701,16 @@ void mtsRobot1394::set_LED_pattern(const prmInputData & pattern)
 void mtsRobot1394::SetWatchdogPeriod(const double & periodInSeconds)
 {
     mWatchdogPeriod = periodInSeconds;
-    for (auto & board : mUniqueBoards) {
-        board.second->WriteWatchdogPeriodInSeconds(periodInSeconds);
+    for (auto board : mUniqueBoards) {
+        board->WriteWatchdogPeriodInSeconds(periodInSeconds);
     }
     EventTriggers.WatchdogPeriod(mWatchdogPeriod);
 }
 
 void mtsRobot1394::WriteSafetyRelay(const bool & close)
 {
-    for (auto & board : mUniqueBoards) {
-        board.second->WriteSafetyRelay(close);
+    for (auto board : mUniqueBoards) {
+        board->WriteSafetyRelay(close);
     }
 }
 
@@ -1496,8 +1719,8 @@ void mtsRobot1394::WritePowerEnable(const bool & power)
     if (power) {
         mSafetyAmpDisabled = false;
     }
-    for (auto & board : mUniqueBoards) {
-        board.second->WritePowerEnable(power);
+    for (auto board : mUniqueBoards) {
+        board->WritePowerEnable(power);
     }
 }
 
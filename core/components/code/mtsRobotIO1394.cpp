@@ -16,21 +16,30 @@ http://www.cisst.org/cisst/license.txt.
 --- end cisst license ---
 */
 
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 #include <cisstBuildType.h>
 #include <cisstCommon/cmnLogger.h>
 #include <cisstCommon/cmnUnits.h>
 
+#include <cisstOSAbstraction/osaStopwatch.h>
 #include <cisstMultiTask/mtsInterfaceProvided.h>
 
 #include <sawRobotIO1394/mtsRobotIO1394.h>
 #include <sawRobotIO1394/mtsDigitalInput1394.h>
 #include <sawRobotIO1394/mtsDigitalOutput1394.h>
 #include <sawRobotIO1394/mtsDallasChip1394.h>
+#include <sawRobotIO1394/mtsAnalogInput1394.h>
 #include <sawRobotIO1394/mtsRobot1394.h>
+#include <sawRobotIO1394/mtsMessageQueue1394.h>
 #include <sawRobotIO1394/osaXML1394.h>
+#include <sawRobotIO1394/osaJSON1394.h>
+#include <sawRobotIO1394/osaConfigurationCache1394.h>
+#include <sawRobotIO1394/osaConfigurationDiff1394.h>
+#include <sawRobotIO1394/osaStartupTrace1394.h>
 
 #include <Amp1394/AmpIORevision.h>
 #include "PortFactory.h"
@@ -54,6 +63,13 @@ mtsRobotIO1394::mtsRobotIO1394(const mtsTaskPeriodicConstructorArg & arg):
 
 mtsRobotIO1394::~mtsRobotIO1394()
 {
+    // stop message thread before deleting robots
+    if (mMessageQueue) {
+        mMessageQueue->Stop();
+        delete mMessageQueue;
+        mMessageQueue = nullptr;
+    }
+
     // delete robots before deleting boards
     for (auto & robot : mRobots) {
         if (robot != 0) {
@@ -90,16 +106,22 @@ mtsRobotIO1394::~mtsRobotIO1394()
     mDallasChips.clear();
     mDallasChipsByName.clear();
 
-    // delete board structures
-    for (board_iterator iter = mBoards.begin();
-         iter != mBoards.end();
-         ++iter) {
-        if (iter->second != 0) {
-            mPort->RemoveBoard(iter->first);
-            delete iter->second;
+    // delete analog inputs before deleting boards
+    for (auto & input : mAnalogInputs) {
+        if (input != 0) {
+            delete input;
         }
     }
-    mBoards.clear();
+    mAnalogInputs.clear();
+    mAnalogInputsByName.clear();
+
+    // delete board structures
+    for (const auto boardID : mBoardIDs) {
+        mPort->RemoveBoard(boardID);
+        delete mBoards[boardID];
+        mBoards[boardID] = nullptr;
+    }
+    mBoardIDs.clear();
 
     // delete firewire port
     if (mPort != 0) {
@@ -135,6 +157,13 @@ void mtsRobotIO1394::SetWatchdogPeriod(const double & periodInSeconds)
 
 void mtsRobotIO1394::Init(const std::string & port)
 {
+    // startup trace can be enabled before the constructor is called
+    const char * traceFile = std::getenv("SAW_ROBOT_IO_1394_STARTUP_TRACE");
+    if (traceFile) {
+        mStartupTrace.SetFilename(traceFile);
+    }
+    osaStartupTrace1394::Scope traceInit(mStartupTrace, "Init");
+
     // write warning to cerr if not compiled in Release mode
     if (std::string(CISST_BUILD_TYPE) != "Release") {
         std::cerr << "---------------------------------------------------- " << std::endl
@@ -149,6 +178,7 @@ void mtsRobotIO1394::Init(const std::string & port)
     // default watchdog period
     mWatchdogPeriod = sawRobotIO1394::WatchdogTimeout;
     mSkipConfigurationCheck = false;
+    mUseConfigurationCache = false;
 
     // add state tables for stats
     mStateTableRead = new mtsStateTable(100, this->GetName() + "Read");
@@ -156,7 +186,11 @@ void mtsRobotIO1394::Init(const std::string & port)
     mStateTableWrite = new mtsStateTable(100, this->GetName() + "Write");
     mStateTableWrite->SetAutomaticAdvance(false);
 
+    // queue for messages from the IO thread, formatted and rate limited by a separate thread
+    mMessageQueue = new mtsMessageQueue1394(*this);
+
     // create port
+    osaStartupTrace1394::Scope tracePort(mStartupTrace, "Init: port " + port);
     mMessageStream = new std::ostream(this->GetLogMultiplexer());
     mPort = PortFactory(port.c_str(), *mMessageStream);
     if (!mPort) {
@@ -178,7 +212,9 @@ void mtsRobotIO1394::Init(const std::string & port)
         CMN_LOG_CLASS_INIT_ERROR << "Init: found more than one user on firewire port: " << port << std::endl;;
         exit(EXIT_FAILURE);
     }
+    tracePort.End();
 
+    osaStartupTrace1394::Scope traceInterfaces(mStartupTrace, "Init: interfaces");
     mtsInterfaceProvided * mainInterface = AddInterfaceProvided("MainInterface");
     if (mainInterface) {
         mainInterface->AddCommandRead(&mtsRobotIO1394::GetNumberOfBoards, this, "GetNumberOfBoards");
@@ -212,10 +248,26 @@ void mtsRobotIO1394::Init(const std::string & port)
                                                 "GetNumDigitalOutputs");
         mConfigurationInterface->AddCommandRead(&mtsRobotIO1394::GetDigitalOutputNames, this,
                                                 "GetDigitalOutputNames");
+        mConfigurationInterface->AddCommandRead(&mtsRobotIO1394::GetNumberOfAnalogInputs, this,
+                                                "GetNumAnalogInputs");
+        mConfigurationInterface->AddCommandRead(&mtsRobotIO1394::GetAnalogInputNames, this,
+                                                "GetAnalogInputNames");
         mConfigurationInterface->AddCommandRead<mtsComponent>(&mtsComponent::GetName, this,
                                                               "GetName");
         mConfigurationInterface->AddCommandVoid(&mtsRobotIO1394::close_all_relays, this,
                                                 "close_all_relays");
+        mConfigurationInterface->AddCommandWrite(&mtsRobotIO1394::set_digital_outputs, this,
+                                                 "set_digital_outputs");
+        mConfigurationInterface->AddCommandQualifiedRead(&mtsRobotIO1394::digital_input_edges, this,
+                                                         "digital_input_edges");
+        // not queued, parsing is done in the caller's thread so the IO
+        // thread only has to copy the new values
+        mConfigurationInterface->AddCommandWrite(&mtsRobotIO1394::reload_calibration, this,
+                                                 "reload_calibration", std::string(),
+                                                 MTS_COMMAND_NOT_QUEUED);
+        mConfigurationInterface->AddCommandWrite(&mtsRobotIO1394::reconfigure, this,
+                                                 "reconfigure", std::string(),
+                                                 MTS_COMMAND_NOT_QUEUED);
         mConfigurationInterface->AddCommandReadState(StateTable, StateTable.PeriodStats,
                                                      "period_statistics");
         mConfigurationInterface->AddCommandReadState(*mStateTableRead, mStateTableRead->PeriodStats,
@@ -245,16 +297,66 @@ void mtsRobotIO1394::SaveConfigurationJSON(const std::string & filename)
     mSaveConfigurationJSON = filename;
 }
 
+void mtsRobotIO1394::UseConfigurationCache(const bool use)
+{
+    mUseConfigurationCache = use;
+}
+
+void mtsRobotIO1394::SetStartupTrace(const std::string & filename)
+{
+    mStartupTrace.SetFilename(filename);
+}
+
+void mtsRobotIO1394::SetDigitalInputHistorySize(const size_t size)
+{
+    mDigitalInputHistorySize = size;
+}
+
+bool mtsRobotIO1394::LoadConfiguration(const std::string & filename,
+                                       osaPort1394Configuration & config) const
+{
+    const std::string extension = ".json";
+    if ((filename.size() > extension.size())
+        && (filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0)) {
+        return osaJSON1394LoadPort(filename, config, mCalibrationMode);
+    }
+    return osaXML1394LoadPort(filename, config, mCalibrationMode);
+}
+
 void mtsRobotIO1394::Configure(const std::string & filename)
 {
     CMN_LOG_CLASS_INIT_VERBOSE << "Configure: configuring from " << filename << std::endl;
 
+    // time spent in each phase, reported at the end
+    osaStopwatch stopwatch;
+    stopwatch.Start();
+    double timeParse, timeSetup, timeQuery, timeCheck;
+    osaStartupTrace1394::Scope traceConfigure(mStartupTrace, "Configure: " + filename);
+    osaStartupTrace1394::Scope traceParse(mStartupTrace, "Configure: parse");
+
+    // JSON files are generated from osaPort1394Configuration and can be
+    // deserialized directly, XML files require one query per attribute
     osaPort1394Configuration config;
-    osaXML1394ConfigurePort(filename, config, mCalibrationMode);
+    const std::string cacheFile = filename + ".cache";
+    if (!mUseConfigurationCache
+        || !osaConfigurationCache1394Load(cacheFile, config, mCalibrationMode)) {
+        if (!LoadConfiguration(filename, config)) {
+            exit(EXIT_FAILURE);
+        }
+        if (mUseConfigurationCache) {
+            osaConfigurationCache1394Save(cacheFile, filename, config, mCalibrationMode);
+        }
+    }
+
+    timeParse = stopwatch.GetElapsedTime();
+    traceParse.End();
+    stopwatch.Reset();
+    stopwatch.Start();
 
     // Add all the robots
     for (const auto & configRobot : config.Robots) {
         // Create a new robot
+        osaStartupTrace1394::Scope traceRobot(mStartupTrace, "Configure: robot " + configRobot.Name);
         mtsRobot1394 * robot = new mtsRobot1394(*this, configRobot, mCalibrationMode);
         // Check the configuration if needed
         if (!mSkipConfigurationCheck) {
@@ -265,6 +367,7 @@ void mtsRobotIO1394::Configure(const std::string & filename)
                 exit(EXIT_FAILURE);
             }
         }
+        traceRobot.End();
         // Set up the cisstMultiTask interfaces
         if (!this->SetupRobot(robot)) {
             CMN_LOG_CLASS_INIT_ERROR << "Configure: unable to setup interface(s) for robot \""
@@ -279,6 +382,7 @@ void mtsRobotIO1394::Configure(const std::string & filename)
     }
 
     // Add all the digital inputs
+    osaStartupTrace1394::Scope traceIOs(mStartupTrace, "Configure: digital inputs, outputs, Dallas chips and analog inputs");
     for (const auto & configInput : config.DigitalInputs) {
         // Create a new digital input
         mtsDigitalInput1394 * digitalInput = new mtsDigitalInput1394(*this, configInput);
@@ -314,21 +418,120 @@ void mtsRobotIO1394::Configure(const std::string & filename)
         }
     }
 
+    // Add all the analog inputs
+    for (const auto & configAnalog : config.AnalogInputs) {
+        mtsAnalogInput1394 * analogInput = new mtsAnalogInput1394(*this, configAnalog);
+        if (!this->SetupAnalogInput(analogInput)) {
+            delete analogInput;
+        } else {
+            AddAnalogInput(analogInput);
+        }
+    }
+
+    // Add reflex rules, inputs, outputs and robots must be added first
+    for (size_t index = 0; index < config.Reflexes.size(); ++index) {
+        AddReflex(config.Reflexes.at(index));
+    }
+
+    traceIOs.End();
+
     // Save as JSON if needed (used to port older XML file to JSON)
     if (!mSaveConfigurationJSON.empty()) {
+        osaStartupTrace1394::Scope traceSave(mStartupTrace, "Configure: save JSON");
         std::ofstream jsonFile;
         jsonFile.open(mSaveConfigurationJSON);
         Json::Value jsonConfig;
         config.SerializeTextJSON(jsonConfig);
+        // brakes are stored as pointers, save the content so
+        // osaJSON1394ConfigurePort can load them back
+        for (Json::ArrayIndex robotIndex = 0; robotIndex < config.Robots.size(); ++robotIndex) {
+            const auto & actuators = config.Robots.at(robotIndex).Actuators;
+            for (Json::ArrayIndex actuatorIndex = 0; actuatorIndex < actuators.size(); ++actuatorIndex) {
+                Json::Value & jsonBrake = jsonConfig["Robots"][robotIndex]["Actuators"][actuatorIndex]["Brake"];
+                if (actuators.at(actuatorIndex).Brake) {
+                    cmnDataJSON<osaAnalogBrake1394Configuration>::SerializeText(*(actuators.at(actuatorIndex).Brake), jsonBrake);
+                } else {
+                    jsonBrake = Json::nullValue;
+                }
+            }
+        }
         Json::StyledWriter writer;
         jsonFile << writer.write(jsonConfig) << std::endl;
         jsonFile.close();
     }
 
+    timeSetup = stopwatch.GetElapsedTime();
+    stopwatch.Reset();
+    stopwatch.Start();
+
+    // Query all boards used by robots once, then check versions per robot
+    QueryBoards();
+    timeQuery = stopwatch.GetElapsedTime();
+    stopwatch.Reset();
+    stopwatch.Start();
+    osaStartupTrace1394::Scope traceCheck(mStartupTrace, "Configure: check boards and firmware");
+    for (auto robot : mRobots) {
+        robot->CheckBoards(mBoardInfo);
+    }
+
     // Check firmware versions used so far
     if (!CheckFirmwareVersions()) {
         exit(EXIT_FAILURE);
     }
+    timeCheck = stopwatch.GetElapsedTime();
+    traceCheck.End();
+
+    std::stringstream report;
+    report << "Configure: startup timing for " << filename << std::endl
+           << "  configuration: " << timeParse * 1000.0 << " ms" << std::endl
+           << "  setup: " << timeSetup * 1000.0 << " ms" << std::endl
+           << "  board queries: " << timeQuery * 1000.0 << " ms for " << mBoardInfo.size() << " board(s)" << std::endl;
+    for (const auto & info : mBoardInfo) {
+        report << "    board " << info.first << ": " << info.second.QueryTime * 1000.0 << " ms" << std::endl;
+    }
+    report << "  checks: " << timeCheck * 1000.0 << " ms" << std::endl;
+    CMN_LOG_CLASS_INIT_VERBOSE << report.str();
+
+    // Keep configuration to compute differences on reconfigure
+    std::lock_guard<std::mutex> lock(mPortConfigurationsMutex);
+    mPortConfigurations[filename] = config;
+}
+
+void mtsRobotIO1394::QueryBoards(void)
+{
+    // the port doesn't support concurrent transactions so queries
+    // are sequential but each board is only queried once
+    osaStartupTrace1394::Scope traceQuery(mStartupTrace, "QueryBoards");
+    osaStopwatch stopwatch;
+    for (auto & info : mBoardInfo) {
+        osaBoardInfo1394 & board = info.second;
+        if (board.FirmwareVersion != 0) {
+            continue; // already queried
+        }
+        osaStartupTrace1394::Scope traceBoard(mStartupTrace,
+                                              "QueryBoards: board " + std::to_string(info.first), "board");
+        stopwatch.Reset();
+        stopwatch.Start();
+        board.HardwareVersion = board.Board->GetHardwareVersion();
+        board.FirmwareVersion = board.Board->GetFirmwareVersion();
+        if (board.HardwareVersion == DQLA_String) {
+            board.QLASerialNumber = board.Board->GetQLASerialNumber(1)
+                + ", " + board.Board->GetQLASerialNumber(2);
+        } else {
+            board.QLASerialNumber = board.Board->GetQLASerialNumber();
+        }
+        if (board.QLASerialNumber.empty()) {
+            board.QLASerialNumber = "unknown";
+        }
+        board.FPGASerialNumber = board.Board->GetFPGASerialNumber();
+        if (board.FPGASerialNumber.empty()) {
+            board.FPGASerialNumber = "unknown";
+        }
+        if (board.HardwareVersion == dRA1_String) {
+            board.RobotSerialNumber = board.Board->ReadRobotSerialNumber();
+        }
+        board.QueryTime = stopwatch.GetElapsedTime();
+    }
 }
 
 bool mtsRobotIO1394::SetupRobot(mtsRobot1394 * robot)
@@ -337,6 +540,7 @@ bool mtsRobotIO1394::SetupRobot(mtsRobot1394 * robot)
     mtsStateTable * stateTableWrite;
 
     // Configure StateTable for this Robot
+    osaStartupTrace1394::Scope traceStateTables(mStartupTrace, "SetupRobot: state tables " + robot->Name());
     if (!robot->SetupStateTables(2000, // hard coded number of elements in state tables
                                  stateTableRead, stateTableWrite)) {
         CMN_LOG_CLASS_INIT_ERROR << "SetupRobot: unable to setup state tables" << std::endl;
@@ -345,9 +549,11 @@ bool mtsRobotIO1394::SetupRobot(mtsRobot1394 * robot)
 
     this->AddStateTable(stateTableRead);
     this->AddStateTable(stateTableWrite);
+    traceStateTables.End();
 
     // Add new InterfaceProvided for this Robot with Name.
     // Ensure all names from XML Config file are UNIQUE!
+    osaStartupTrace1394::Scope traceInterface(mStartupTrace, "SetupRobot: interface " + robot->Name());
     mtsInterfaceProvided * robotInterface = this->AddInterfaceProvided(robot->Name());
     if (!robotInterface) {
         CMN_LOG_CLASS_INIT_ERROR << "SetupRobot: failed to create robot interface \""
@@ -360,6 +566,7 @@ bool mtsRobotIO1394::SetupRobot(mtsRobot1394 * robot)
 
     // Setup the MTS interfaces
     robot->SetupInterfaces(robotInterface);
+    robot->SetMessageQueue(mMessageQueue);
 
     return true;
 }
@@ -397,23 +604,61 @@ bool mtsRobotIO1394::SetupDallasChip(mtsDallasChip1394 * dallasChip)
     return true;
 }
 
+bool mtsRobotIO1394::SetupAnalogInput(mtsAnalogInput1394 * analogInput)
+{
+    analogInput->SetupStateTable(this->StateTable);
+
+    mtsInterfaceProvided * analogInInterface = this->AddInterfaceProvided(analogInput->Name());
+
+    analogInput->SetupProvidedInterface(analogInInterface, this->StateTable);
+    return true;
+}
+
 void mtsRobotIO1394::Startup(void)
 {
+    osaStartupTrace1394::Scope traceStartup(mStartupTrace, "Startup");
+
+    // Configure can be called once per file, all robots have been added
+    // now so start processing messages
+    mMessageQueue->Start();
+
     // Use preferred watchdog timeout
+    osaStartupTrace1394::Scope traceWatchdog(mStartupTrace, "Startup: watchdog");
     SetWatchdogPeriod(mWatchdogPeriod);
+    traceWatchdog.End();
 
-    // Robot Startup
+    // Robot Startup, includes serial number check for dRA1
     for (auto & robot : mRobots) {
+        osaStartupTrace1394::Scope traceRobot(mStartupTrace, "Startup: " + robot->Name());
         robot->Startup();
     }
+
+    // Last startup phase, save trace if requested
+    traceStartup.End();
+    if (mStartupTrace.Enabled()) {
+        if (mStartupTrace.Save()) {
+            CMN_LOG_CLASS_INIT_VERBOSE << "Startup: startup trace saved in "
+                                       << mStartupTrace.Filename() << std::endl;
+        } else {
+            CMN_LOG_CLASS_INIT_WARNING << "Startup: unable to save startup trace in "
+                                       << mStartupTrace.Filename() << std::endl;
+        }
+    }
 }
 
 void mtsRobotIO1394::PreRead(void)
 {
     mStateTableRead->Start();
+    // messages are staged after the values they report on, take them
+    // first so these values are applied below
+    TakeConfigurationMessages();
     for (auto & robot : mRobots) {
+        // swap calibration between cycles, no-op if nothing is staged
+        robot->ApplyStagedCalibration();
         robot->StartReadStateTable();
     }
+    ApplyPendingReconfiguration();
+    SendConfigurationMessages();
 }
 
 void mtsRobotIO1394::Read(void)
@@ -421,6 +666,15 @@ void mtsRobotIO1394::Read(void)
     // Read from all boards on the port
     mPort->ReadAllBoards();
 
+    // Extract board level values once for all robots and inputs
+    for (const auto boardID : mBoardIDs) {
+        osaBoardSnapshot1394 & snapshot = mBoardSnapshots[boardID];
+        snapshot.Update(*(mBoards[boardID]));
+        if (snapshot.Valid) {
+            mDigitalInputHistories[boardID].Update(snapshot.FPGATime, snapshot.DigitalInput);
+        }
+    }
+
     // Poll the state for each robot
     for (auto & robot : mRobots) {
         // Poll the board validity
@@ -432,10 +686,8 @@ void mtsRobotIO1394::Read(void)
         // Convert bits to usable numbers
         robot->ConvertState();
     }
-    // Poll the state for each digital input
-    for (auto & input : mDigitalInputs) {
-        input->PollState();
-    }
+    // Poll the state for digital inputs with changed bits
+    mDigitalInputEngine.PollState();
     // Poll the state for each digital output
     for (auto & output : mDigitalOutputs) {
         output->PollState();
@@ -444,6 +696,10 @@ void mtsRobotIO1394::Read(void)
     for (auto & dallas: mDallasChips) {
         dallas->PollState();
     }
+    // Poll, convert and filter each analog input
+    for (auto & analog : mAnalogInputs) {
+        analog->PollState();
+    }
 }
 
 void mtsRobotIO1394::PostRead(void)
@@ -463,9 +719,13 @@ void mtsRobotIO1394::PostRead(void)
         robot->AdvanceReadStateTable();
     }
     // Trigger digital input events
-    for (auto & input : mDigitalInputs) {
-        input->CheckState();
+    mDigitalInputEngine.CheckState();
+    // Decimated values and statistics
+    for (auto & analog : mAnalogInputs) {
+        analog->CheckState();
     }
+    // Reflex rules, outputs are written and power turned off in this cycle
+    mReflexEngine.Evaluate();
 }
 
 bool mtsRobotIO1394::IsOK(void) const
@@ -482,9 +742,28 @@ void mtsRobotIO1394::PreWrite(void)
 }
 
 void mtsRobotIO1394::Write(void)
+{
+    // Sequences and triggers, after commands so new sequences start
+    // this cycle.  Outputs held by reflex rules are requested last
+    for (auto & output : mDigitalOutputs) {
+        output->StepSequence();
+        output->StepTrigger();
+        output->StepHold();
+    }
+    WriteBoards();
+}
+
+void mtsRobotIO1394::WriteBoards(void)
 {
     // Write to all boards
     mPort->WriteAllBoards();
+    // Digital outputs changed during this cycle, one write per board
+    for (const auto boardID : mBoardIDs) {
+        if (!mDigitalOutputBatches[boardID].Flush(*(mBoards[boardID]))) {
+            CMN_LOG_CLASS_RUN_ERROR << "Write: failed to write digital outputs for board "
+                                    << boardID << std::endl;
+        }
+    }
 }
 
 void mtsRobotIO1394::PostWrite(void)
@@ -494,6 +773,8 @@ void mtsRobotIO1394::PostWrite(void)
     for (auto & robot : mRobots) {
         robot->AdvanceWriteStateTable();
     }
+    // Send messages formatted by the message queue thread
+    mMessageQueue->Dispatch();
 }
 
 void mtsRobotIO1394::Run(void)
@@ -540,8 +821,8 @@ void mtsRobotIO1394::Cleanup(void)
             mRobots[i]->PowerOffSequence(true /* open safety relays */);
         }
     }
-    // Write to all boards
-    Write();
+    // Write to all boards, don't step sequences or triggers
+    WriteBoards();
 }
 
 void mtsRobotIO1394::GetNumberOfDigitalInputs(size_t & placeHolder) const
@@ -564,9 +845,14 @@ void mtsRobotIO1394::GetNumberOfDigitalOutputs(size_t & placeHolder) const
     placeHolder = mDigitalOutputs.size();
 }
 
+void mtsRobotIO1394::GetNumberOfAnalogInputs(size_t & placeHolder) const
+{
+    placeHolder = mAnalogInputs.size();
+}
+
 void mtsRobotIO1394::GetNumberOfBoards(size_t & placeHolder) const
 {
-    placeHolder = mBoards.size();
+    placeHolder = mBoardIDs.size();
 }
 
 void mtsRobotIO1394::GetNumberOfRobots(size_t & placeHolder) const
@@ -607,6 +893,21 @@ void mtsRobotIO1394::GetNumberOfBrakesPerRobot(vctIntVec & placeHolder) const
     }
 }
 
+AmpIO * mtsRobotIO1394::UseBoard(const int boardID)
+{
+    if ((boardID < 0) || (boardID >= MAX_BOARDS)) {
+        cmnThrow("mtsRobotIO1394::UseBoard: invalid board ID " + std::to_string(boardID));
+    }
+    // If the board hasn't been created, construct it and add it to the port
+    if (mBoards[boardID] == nullptr) {
+        mBoards[boardID] = new AmpIO(boardID);
+        mPort->AddBoard(mBoards[boardID]);
+        mBoardIDs.push_back(boardID);
+        mDigitalInputHistories[boardID].SetCapacity(mDigitalInputHistorySize);
+    }
+    return mBoards[boardID];
+}
+
 void mtsRobotIO1394::AddRobot(mtsRobot1394 * robot)
 {
     if (robot == 0) {
@@ -614,12 +915,27 @@ void mtsRobotIO1394::AddRobot(mtsRobot1394 * robot)
     }
 
     const osaRobot1394Configuration & config = robot->GetConfiguration();
+    osaStartupTrace1394::Scope traceAdd(mStartupTrace, "AddRobot: " + config.Name);
 
     // Check to make sure this robot isn't already added
     if (mRobotsByName.count(config.Name) > 0) {
         cmnThrow(robot->Name() + ": robot name is not unique.");
     }
 
+    // Pots can't use an axis already used by an analog input, analog
+    // inputs might have been added by a previous Configure
+    for (int i = 0; i < config.NumberOfActuators; i++) {
+        const osaActuator1394Configuration & actuator = config.Actuators[i];
+        for (const auto analogInput : mAnalogInputs) {
+            const osaAnalogInput1394Configuration & configAnalog = analogInput->Configuration();
+            if ((configAnalog.BoardID == actuator.BoardID) && (configAnalog.AxisID == actuator.AxisID)) {
+                cmnThrow(robot->Name() + ": board " + std::to_string(actuator.BoardID)
+                         + " axis " + std::to_string(actuator.AxisID) + " for the pot of actuator "
+                         + std::to_string(i) + " is already used by analog input " + analogInput->Name() + ".");
+            }
+        }
+    }
+
     // Construct a vector of boards relevant to this robot
     std::vector<osaActuatorMapping> actuatorBoards(config.NumberOfActuators);
     std::vector<osaBrakeMapping> brakeBoards(config.NumberOfBrakes);
@@ -629,12 +945,12 @@ void mtsRobotIO1394::AddRobot(mtsRobot1394 * robot)
 
         // Board for the actuator
         int boardId = config.Actuators[i].BoardID;
+        UseBoard(boardId);
 
-        // If the board hasn't been created, construct it and add it to the port
-        if (mBoards.count(boardId) == 0) {
-            mBoards[boardId] = new AmpIO(boardId);
-            mPort->AddBoard(mBoards[boardId]);
-        }
+        // Board information is queried later, once per board
+        mBoardInfo[boardId].Board = mBoards[boardId];
+        mBoardInfo[boardId].BoardID = boardId;
+        mBoardSnapshots[boardId].UseTemperatureForAxis(config.Actuators[i].AxisID);
 
         // Add the board to the list of boards relevant to this robot
         actuatorBoards[i].Board = mBoards[boardId];
@@ -646,12 +962,11 @@ void mtsRobotIO1394::AddRobot(mtsRobot1394 * robot)
         if (brake) {
             // Board for the brake
             boardId = brake->BoardID;
+            UseBoard(boardId);
 
-            // If the board hasn't been created, construct it and add it to the port
-            if (mBoards.count(boardId) == 0) {
-                mBoards[boardId] = new AmpIO(boardId);
-                mPort->AddBoard(mBoards[boardId]);
-            }
+            mBoardInfo[boardId].Board = mBoards[boardId];
+            mBoardInfo[boardId].BoardID = boardId;
+            mBoardSnapshots[boardId].UseTemperatureForAxis(brake->AxisID);
 
             // Add the board to the list of boards relevant to this robot
             brakeBoards[currentBrake].Board = mBoards[boardId];
@@ -662,7 +977,10 @@ void mtsRobotIO1394::AddRobot(mtsRobot1394 * robot)
     }
 
     // Set the robot boards
+    osaStartupTrace1394::Scope traceSetBoards(mStartupTrace, "SetBoards: " + config.Name);
     robot->SetBoards(actuatorBoards, brakeBoards);
+    robot->SetBoardSnapshots(mBoardSnapshots);
+    traceSetBoards.End();
 
     // Store the robot by name
     mRobots.push_back(robot);
@@ -684,15 +1002,11 @@ void mtsRobotIO1394::AddDigitalInput(mtsDigitalInput1394 * digitalInput)
 
     // Construct a vector of boards relevant to this digital input
     int boardID = config.BoardID;
-
-    // If the board hasn't been created, construct it and add it to the port
-    if (mBoards.count(boardID) == 0) {
-        mBoards[boardID] = new AmpIO(boardID);
-        mPort->AddBoard(mBoards[boardID]);
-    }
+    UseBoard(boardID);
 
     // Assign the board to the digital input
-    digitalInput->SetBoard(mBoards[boardID]);
+    digitalInput->SetBoardSnapshot(&(mBoardSnapshots[boardID]));
+    mDigitalInputEngine.Add(digitalInput);
 
     // Store the digital input by name
     mDigitalInputs.push_back(digitalInput);
@@ -714,21 +1028,48 @@ void mtsRobotIO1394::AddDigitalOutput(mtsDigitalOutput1394 * digitalOutput)
 
     // Construct a vector of boards relevant to this digital output
     int boardID = config.BoardID;
-
-    // If the board hasn't been created, construct it and add it to the port
-    if (mBoards.count(boardID) == 0) {
-        mBoards[boardID] = new AmpIO(boardID);
-        mPort->AddBoard(mBoards[boardID]);
-    }
+    UseBoard(boardID);
 
     // Assign the board to the digital output
     digitalOutput->SetBoard(mBoards[boardID]);
+    digitalOutput->SetBatch(&(mDigitalOutputBatches[boardID]));
+    digitalOutput->SetBoardSnapshot(&(mBoardSnapshots[boardID]));
 
     // Store the digital output by name
     mDigitalOutputs.push_back(digitalOutput);
     mDigitalOutputsByName[config.Name] = digitalOutput;
 }
 
+void mtsRobotIO1394::AddReflex(const osaReflex1394Configuration & config)
+{
+    osaReflexEngine1394::Rule rule;
+    const auto input = mDigitalInputsByName.find(config.Input);
+    if (input == mDigitalInputsByName.end()) {
+        cmnThrow("mtsRobotIO1394::AddReflex: unknown digital input \"" + config.Input + "\".");
+    }
+    rule.Input = input->second;
+    rule.WhenPressed = config.WhenPressed;
+    if (!config.Output.empty()) {
+        const auto output = mDigitalOutputsByName.find(config.Output);
+        if (output == mDigitalOutputsByName.end()) {
+            cmnThrow("mtsRobotIO1394::AddReflex: unknown digital output \"" + config.Output + "\".");
+        }
+        rule.Output = output->second;
+        rule.OutputValue = config.OutputValue;
+    }
+    if (!config.PowerOff.empty()) {
+        const auto robot = mRobotsByName.find(config.PowerOff);
+        if (robot == mRobotsByName.end()) {
+            cmnThrow("mtsRobotIO1394::AddReflex: unknown robot \"" + config.PowerOff + "\".");
+        }
+        rule.Robot = robot->second;
+    }
+    if (!rule.Output && !rule.Robot) {
+        cmnThrow("mtsRobotIO1394::AddReflex: rule for \"" + config.Input + "\" has no action.");
+    }
+    mReflexEngine.Add(rule);
+}
+
 void mtsRobotIO1394::AddDallasChip(mtsDallasChip1394 * dallasChip)
 {
     if (dallasChip == 0) {
@@ -744,21 +1085,59 @@ void mtsRobotIO1394::AddDallasChip(mtsDallasChip1394 * dallasChip)
 
     // Construct a vector of boards relevant to this Dallas chip
     int boardID = config.BoardID;
-
-    // If the board hasn't been created, construct it and add it to the port
-    if (mBoards.count(boardID) == 0) {
-        mBoards[boardID] = new AmpIO(boardID);
-        mPort->AddBoard(mBoards[boardID]);
-    }
+    UseBoard(boardID);
 
     // Assign the board to the Dallas chip
     dallasChip->SetBoard(mBoards[boardID]);
+    dallasChip->SetBoardSnapshot(&(mBoardSnapshots[boardID]));
 
     // Store the digital output by name
     mDallasChips.push_back(dallasChip);
     mDallasChipsByName[config.Name] = dallasChip;
 }
 
+void mtsRobotIO1394::AddAnalogInput(mtsAnalogInput1394 * analogInput)
+{
+    if (analogInput == 0) {
+        cmnThrow("mtsRobotIO1394::AddAnalogInput: analog input pointer is null.");
+    }
+
+    const osaAnalogInput1394Configuration & config = analogInput->Configuration();
+
+    // Check to make sure this analog input isn't already added
+    if (mAnalogInputsByName.count(config.Name) > 0) {
+        cmnThrow(analogInput->Name() + ": analog input name is not unique.");
+    }
+
+    // Construct a vector of boards relevant to this analog input
+    int boardID = config.BoardID;
+    UseBoard(boardID);
+
+    // Axis must exist on this board and its analog input can't be a robot's pot
+    if (static_cast<unsigned int>(config.AxisID) >= mBoards[boardID]->GetNumMotors()) {
+        cmnThrow(analogInput->Name() + ": axis " + std::to_string(config.AxisID)
+                 + " doesn't exist on board " + std::to_string(boardID) + ".");
+    }
+    for (const auto robot : mRobots) {
+        const osaRobot1394Configuration & configRobot = robot->GetConfiguration();
+        for (size_t index = 0; index < configRobot.Actuators.size(); ++index) {
+            const osaActuator1394Configuration & actuator = configRobot.Actuators.at(index);
+            if ((actuator.BoardID == boardID) && (actuator.AxisID == config.AxisID)) {
+                cmnThrow(analogInput->Name() + ": board " + std::to_string(boardID)
+                         + " axis " + std::to_string(config.AxisID) + " is already used for the pot of "
+                         + robot->Name() + " actuator " + std::to_string(index) + ".");
+            }
+        }
+    }
+
+    // Assign the board to the analog input
+    analogInput->SetBoard(mBoards[boardID]);
+
+    // Store the analog input by name
+    mAnalogInputs.push_back(analogInput);
+    mAnalogInputsByName[config.Name] = analogInput;
+}
+
 bool mtsRobotIO1394::CheckFirmwareVersions(void)
 {
     unsigned int lowest = 99999;
@@ -863,6 +1242,14 @@ void mtsRobotIO1394::GetDigitalOutputNames(std::vector<std::string> & names) con
     }
 }
 
+void mtsRobotIO1394::GetAnalogInputNames(std::vector<std::string> & names) const
+{
+    names.clear();
+    for (const auto & input : mAnalogInputs) {
+        names.push_back(input->Name());
+    }
+}
+
 void mtsRobotIO1394::close_all_relays(void)
 {
     if (mPort) {
@@ -873,6 +1260,321 @@ void mtsRobotIO1394::close_all_relays(void)
     }
 }
 
+void mtsRobotIO1394::set_digital_outputs(const osaDigitalOutputValues1394 & values)
+{
+    if (values.Names.size() != values.Values.size()) {
+        mConfigurationInterface->SendError("set_digital_outputs: number of names and values don't match");
+        return;
+    }
+    // check all names first so the outputs are either all set or none
+    for (const auto & name : values.Names) {
+        if (mDigitalOutputsByName.count(name) == 0) {
+            mConfigurationInterface->SendError("set_digital_outputs: unknown digital output \"" + name + "\"");
+            return;
+        }
+    }
+    for (size_t index = 0; index < values.Names.size(); ++index) {
+        mDigitalOutputsByName[values.Names.at(index)]->SetValue(values.Values.at(index));
+    }
+}
+
+void mtsRobotIO1394::digital_input_edges(const osaDigitalInputEdgeQuery1394 & query,
+                                         osaDigitalInputEdges1394 & edges) const
+{
+    int boardID = query.BoardID;
+    int bitID = query.BitID;
+    if (!query.Input.empty()) {
+        const auto input = mDigitalInputsByName.find(query.Input);
+        if (input == mDigitalInputsByName.end()) {
+            edges = osaDigitalInputEdges1394();
+            edges.Complete = false;
+            edges.Message = "digital_input_edges: unknown digital input \"" + query.Input + "\"";
+            return;
+        }
+        boardID = input->second->Configuration().BoardID;
+        bitID = input->second->Configuration().BitID;
+    }
+    if ((boardID < 0) || (boardID >= MAX_BOARDS) || (mBoards[boardID] == nullptr)
+        || (bitID < 0) || (bitID > 31)) {
+        edges = osaDigitalInputEdges1394();
+        edges.Complete = false;
+        edges.Message = "digital_input_edges: invalid board " + std::to_string(boardID)
+            + " or bit " + std::to_string(bitID);
+        return;
+    }
+    edges.Message.clear();
+    std::vector<double> times;
+    std::vector<bool> values;
+    const uint32_t mask = static_cast<uint32_t>(1) << bitID;
+    edges.Complete = mDigitalInputHistories[boardID].Edges(mask, query.Since,
+                                                           times, values, edges.LastTime);
+    edges.Times.SetSize(times.size());
+    edges.Values.SetSize(values.size());
+    for (size_t index = 0; index < times.size(); ++index) {
+        edges.Times.at(index) = times.at(index);
+        edges.Values.at(index) = values.at(index);
+    }
+}
+
+void mtsRobotIO1394::reload_calibration(const std::string & filename)
+{
+    osaPort1394Configuration config;
+    if (!LoadConfiguration(filename, config)) {
+        StageConfigurationMessage(CONFIGURATION_ERROR,
+                                  "reload_calibration: failed to load \"" + filename + "\"");
+        return;
+    }
+    // check all robots before staging anything so a bad file doesn't
+    // leave the system partially updated
+    std::vector<mtsRobot1394 *> robots;
+    robots.reserve(config.Robots.size());
+    for (const auto & configRobot : config.Robots) {
+        const auto found = mRobotsByName.find(configRobot.Name);
+        if (found == mRobotsByName.end()) {
+            StageConfigurationMessage(CONFIGURATION_ERROR,
+                                      "reload_calibration: robot \"" + configRobot.Name
+                                      + "\" not found in current configuration");
+            return;
+        }
+        std::string errorMessage;
+        if (!found->second->CheckCalibration(configRobot, mSkipConfigurationCheck, errorMessage)) {
+            StageConfigurationMessage(CONFIGURATION_ERROR, "reload_calibration: " + errorMessage);
+            return;
+        }
+        robots.push_back(found->second);
+    }
+
+    std::string notStaged;
+    size_t numberStaged = 0;
+    std::lock_guard<std::mutex> lock(mPortConfigurationsMutex);
+    for (size_t index = 0; index < robots.size(); ++index) {
+        if (!robots.at(index)->StageCalibration(config.Robots.at(index))) {
+            notStaged += " \"" + robots.at(index)->Name() + "\"";
+            continue;
+        }
+        ++numberStaged;
+        // keep track of values applied for reconfigure
+        for (auto & portConfiguration : mPortConfigurations) {
+            for (auto & robot : portConfiguration.second.Robots) {
+                if (robot.Name == config.Robots.at(index).Name) {
+                    robot = config.Robots.at(index);
+                }
+            }
+        }
+    }
+    if (notStaged.empty()) {
+        StageConfigurationMessage(CONFIGURATION_STATUS,
+                                  "reload_calibration: applied calibration from \"" + filename + "\"");
+    } else {
+        StageConfigurationMessage(CONFIGURATION_ERROR,
+                                  std::string("reload_calibration: ")
+                                  + ((numberStaged == 0) ? "nothing" : "partially")
+                                  + " applied from \"" + filename
+                                  + "\", previous calibration not applied yet for" + notStaged
+                                  + ", try again later");
+    }
+}
+
+void mtsRobotIO1394::reconfigure(const std::string & filename)
+{
+    osaPort1394Configuration config;
+    if (!LoadConfiguration(filename, config)) {
+        StageConfigurationMessage(CONFIGURATION_ERROR,
+                                  "reconfigure: failed to load \"" + filename + "\"");
+        return;
+    }
+    std::string message;
+    if (Reconfigure(filename, config, message)) {
+        StageConfigurationMessage(CONFIGURATION_STATUS, message);
+    } else {
+        StageConfigurationMessage(CONFIGURATION_ERROR, message);
+    }
+}
+
+bool mtsRobotIO1394::Reconfigure(const std::string & filename,
+                                 const osaPort1394Configuration & config,
+                                 std::string & message)
+{
+    // held until the configuration kept is updated
+    std::lock_guard<std::mutex> lock(mPortConfigurationsMutex);
+    const auto current = mPortConfigurations.find(filename);
+    if (current == mPortConfigurations.end()) {
+        message = "Reconfigure: \"" + filename + "\" was not used to configure this component, restart required";
+        return false;
+    }
+    osaConfigurationDiff1394 diff;
+    osaConfigurationDiff1394Compute(current->second, config, diff);
+    std::stringstream summary;
+    diff.ToStream(summary, config);
+    CMN_LOG_CLASS_RUN_VERBOSE << "Reconfigure: differences found" << std::endl
+                              << summary.str();
+
+    if (diff.Empty()) {
+        message = "Reconfigure: no change found";
+        return true;
+    }
+    if (diff.RequiresRestart()) {
+        message = "Reconfigure: some changes require a restart, nothing applied\n" + summary.str();
+        return false;
+    }
+
+    // boards can't be added to the port while running
+    auto boardMissing = [this](const int boardID) {
+        return (boardID < 0) || (boardID >= MAX_BOARDS) || (mBoards[boardID] == nullptr);
+    };
+    for (const auto index : diff.DigitalInputsChanged) {
+        if (boardMissing(config.DigitalInputs.at(index).BoardID)) {
+            message = "Reconfigure: digital input \"" + config.DigitalInputs.at(index).Name + "\" uses a new board, restart required";
+            return false;
+        }
+    }
+    for (const auto index : diff.DigitalOutputsChanged) {
+        if (boardMissing(config.DigitalOutputs.at(index).BoardID)) {
+            message = "Reconfigure: digital output \"" + config.DigitalOutputs.at(index).Name + "\" uses a new board, restart required";
+            return false;
+        }
+    }
+    for (const auto index : diff.DallasChipsChanged) {
+        if (boardMissing(config.DallasChips.at(index).BoardID)) {
+            message = "Reconfigure: Dallas chip \"" + config.DallasChips.at(index).Name + "\" uses a new board, restart required";
+            return false;
+        }
+    }
+
+    // robots with new calibration, check all before staging anything
+    for (const auto index : diff.RobotsCalibrationChanged) {
+        const osaRobot1394Configuration & configRobot = config.Robots.at(index);
+        std::string errorMessage;
+        if (!mRobotsByName[configRobot.Name]->CheckCalibration(configRobot, mSkipConfigurationCheck, errorMessage)) {
+            message = "Reconfigure: " + errorMessage;
+            return false;
+        }
+    }
+
+    // digital IOs, copied so the IO thread doesn't use the caller's configuration
+    int expected = RECONFIGURATION_IDLE;
+    if (!mPendingReconfigurationState.compare_exchange_strong(expected, RECONFIGURATION_STAGING)) {
+        message = "Reconfigure: previous reconfiguration not applied yet, try again later";
+        return false;
+    }
+    mPendingReconfiguration = PendingReconfiguration();
+    for (const auto index : diff.DigitalInputsChanged) {
+        const osaDigitalInput1394Configuration & configInput = config.DigitalInputs.at(index);
+        mPendingReconfiguration.DigitalInputsChanged.push_back(std::make_pair(mDigitalInputsByName[configInput.Name],
+                                                                              configInput));
+    }
+    for (const auto index : diff.DigitalOutputsChanged) {
+        const osaDigitalOutput1394Configuration & configOutput = config.DigitalOutputs.at(index);
+        mPendingReconfiguration.DigitalOutputsChanged.push_back(std::make_pair(mDigitalOutputsByName[configOutput.Name],
+                                                                               configOutput));
+    }
+    for (const auto index : diff.DallasChipsChanged) {
+        const osaDallasChip1394Configuration & configChip = config.DallasChips.at(index);
+        mPendingReconfiguration.DallasChipsChanged.push_back(std::make_pair(mDallasChipsByName[configChip.Name],
+                                                                            configChip));
+    }
+    // new digital input layout, boards and masks might have changed
+    if (!diff.DigitalInputsChanged.empty()) {
+        for (auto input : mDigitalInputs) {
+            const osaBoardSnapshot1394 * snapshot = input->BoardSnapshot();
+            uint32_t bitMask = input->BitMask();
+            for (const auto & changed : mPendingReconfiguration.DigitalInputsChanged) {
+                if (changed.first == input) {
+                    snapshot = &(mBoardSnapshots[changed.second.BoardID]);
+                    bitMask = static_cast<uint32_t>(0x1) << changed.second.BitID;
+                }
+            }
+            mPendingReconfiguration.DigitalInputEngine.Add(input, snapshot, bitMask);
+        }
+    }
+    mPendingReconfigurationState.store(RECONFIGURATION_READY, std::memory_order_release);
+
+    // robots not staged keep their previous configuration
+    osaPort1394Configuration applied = config;
+    bool good = true;
+    for (const auto index : diff.RobotsCalibrationChanged) {
+        const osaRobot1394Configuration & configRobot = config.Robots.at(index);
+        if (!mRobotsByName[configRobot.Name]->StageCalibration(configRobot)) {
+            summary << "  calibration for " << configRobot.Name << " not applied, previous calibration still pending" << std::endl;
+            good = false;
+            for (const auto & previous : current->second.Robots) {
+                if (previous.Name == configRobot.Name) {
+                    applied.Robots.at(index) = previous;
+                }
+            }
+        }
+    }
+
+    current->second = applied;
+    message = std::string("Reconfigure: ") + (good ? "applied" : "partially applied") + "\n" + summary.str();
+    return good;
+}
+
+void mtsRobotIO1394::ApplyPendingReconfiguration(void)
+{
+    if (mPendingReconfigurationState.load(std::memory_order_acquire) != RECONFIGURATION_READY) {
+        return;
+    }
+    // no memory allocated, see Reconfigure
+    for (const auto & changed : mPendingReconfiguration.DigitalInputsChanged) {
+        changed.first->Reconfigure(changed.second);
+        changed.first->SetBoardSnapshot(&(mBoardSnapshots[changed.second.BoardID]));
+    }
+    if (!mPendingReconfiguration.DigitalInputsChanged.empty()) {
+        // layout built by Reconfigure, first run restarted.  The
+        // previous layout is released by the next Reconfigure
+        mDigitalInputEngine.Swap(mPendingReconfiguration.DigitalInputEngine);
+    }
+    for (const auto & changed : mPendingReconfiguration.DigitalOutputsChanged) {
+        const int boardID = changed.second.BoardID;
+        changed.first->Reconfigure(changed.second);
+        changed.first->SetBoard(mBoards[boardID]);
+        changed.first->SetBatch(&(mDigitalOutputBatches[boardID]));
+        changed.first->SetBoardSnapshot(&(mBoardSnapshots[boardID]));
+    }
+    for (const auto & changed : mPendingReconfiguration.DallasChipsChanged) {
+        const int boardID = changed.second.BoardID;
+        changed.first->Reconfigure(changed.second);
+        changed.first->SetBoard(mBoards[boardID]);
+        changed.first->SetBoardSnapshot(&(mBoardSnapshots[boardID]));
+    }
+    mPendingReconfigurationState.store(RECONFIGURATION_IDLE, std::memory_order_release);
+}
+
+void mtsRobotIO1394::StageConfigurationMessage(const ConfigurationMessageType type,
+                                               const std::string & text)
+{
+    std::lock_guard<std::mutex> lock(mConfigurationMessagesMutex);
+    mConfigurationMessagesStaged.push_back({type, text});
+}
+
+void mtsRobotIO1394::TakeConfigurationMessages(void)
+{
+    // don't wait for the caller's thread, messages will be sent next cycle
+    std::unique_lock<std::mutex> lock(mConfigurationMessagesMutex, std::try_to_lock);
+    if (lock.owns_lock() && !mConfigurationMessagesStaged.empty()) {
+        mConfigurationMessagesToSend.swap(mConfigurationMessagesStaged);
+    }
+}
+
+void mtsRobotIO1394::SendConfigurationMessages(void)
+{
+    for (const auto & message : mConfigurationMessagesToSend) {
+        switch (message.Type) {
+        case CONFIGURATION_ERROR:
+            mConfigurationInterface->SendError(message.Text);
+            break;
+        case CONFIGURATION_WARNING:
+            mConfigurationInterface->SendWarning(message.Text);
+            break;
+        default:
+            mConfigurationInterface->SendStatus(message.Text);
+            break;
+        }
+    }
+    mConfigurationMessagesToSend.clear();
+}
+
 void mtsRobotIO1394::IntervalStatisticsCallback(void)
 {
     // if the data is recent, arbitrary 10 seconds, ignore stats
@@ -886,45 +1588,30 @@ void mtsRobotIO1394::IntervalStatisticsCallback(void)
     // sleep.  Cause is not known so far
     const double expectedDelay = 0.06 * cmn_ms;
     const double expectedPeriod = GetPeriodicity() + expectedDelay;
-    bool sendingMessage = false;
-    bool error = false;
-    std::stringstream message;
-    message.precision(2);
 
     // check periodicity
     if (StateTable.PeriodStats.PeriodAvg() > sawRobotIO1394::TimingMaxRatio * expectedPeriod) {
-        sendingMessage = true;
-        error = true;
-        message << "average period (" << cmnInternalTo_ms(StateTable.PeriodStats.PeriodAvg())
-                << " ms) exceeded " << sawRobotIO1394::TimingMaxRatio << " time expected period ("
-                << cmnInternalTo_ms(expectedPeriod) << " ms)";
-    }
-
-    // check load
-    if (!error) {
-        if (StateTable.PeriodStats.ComputeTimeAvg() > expectedPeriod) {
-            if (now >= (mTimeLastTimingWarning + sawRobotIO1394::TimeBetweenTimingWarnings)) {
-                sendingMessage = true;
-                message << "average compute time (" << cmnInternalTo_ms(StateTable.PeriodStats.ComputeTimeAvg())
-                        << " ms) exceeds expected period ("
-                        << cmnInternalTo_ms(expectedPeriod) << " ms)";
-                mTimeLastTimingWarning = now;
-            }
-        } else {
-            // reset time so next time we hit a warning it displays immediately
-            mTimeLastTimingWarning = 0.0;
+        for (auto & robot : mRobots) {
+            robot->Report(osa1394::PERIOD_EXCEEDED, -1,
+                          cmnInternalTo_ms(StateTable.PeriodStats.PeriodAvg()),
+                          sawRobotIO1394::TimingMaxRatio,
+                          cmnInternalTo_ms(expectedPeriod));
         }
+        return;
     }
 
-    // send message as needed
-    if (sendingMessage) {
-        std::string messageString = " IO: " + message.str();
-        for (auto & robot : mRobots) {
-            if (error) {
-                robot->mInterface->SendError(robot->Name() + messageString);
-            } else {
-                robot->mInterface->SendWarning(robot->Name() + messageString);
+    // check load
+    if (StateTable.PeriodStats.ComputeTimeAvg() > expectedPeriod) {
+        if (now >= (mTimeLastTimingWarning + sawRobotIO1394::TimeBetweenTimingWarnings)) {
+            for (auto & robot : mRobots) {
+                robot->Report(osa1394::COMPUTE_TIME_EXCEEDED, -1,
+                              cmnInternalTo_ms(StateTable.PeriodStats.ComputeTimeAvg()),
+                              cmnInternalTo_ms(expectedPeriod));
             }
+            mTimeLastTimingWarning = now;
         }
+    } else {
+        // reset time so next time we hit a warning it displays immediately
+        mTimeLastTimingWarning = 0.0;
     }
 }
@@ -0,0 +1,120 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawRobotIO1394/osaAnalogFilter1394.h>
+
+namespace sawRobotIO1394 {
+
+    bool osaAnalogFilter1394::Configure(const std::vector<double> & fir,
+                                        const double iir,
+                                        const int decimation,
+                                        const int window,
+                                        std::string & message)
+    {
+        if (!((iir > 0.0) && (iir <= 1.0))) {
+            message = "IIR smoothing factor must be in ]0, 1]";
+            return false;
+        }
+        if (decimation < 1) {
+            message = "decimation must be at least 1";
+            return false;
+        }
+        if (window < 0) {
+            message = "window can't be negative";
+            return false;
+        }
+        mFIR = fir;
+        mHistory.assign(mFIR.size(), 0.0);
+        mIIR = iir;
+        mDecimation = decimation;
+        mWindow = window;
+        Reset();
+        return true;
+    }
+
+    void osaAnalogFilter1394::Reset(void)
+    {
+        mHistoryIndex = 0;
+        mNumberOfSamples = 0;
+        mDecimationCounter = 0;
+        mWindowCounter = 0;
+        mWindowCompleted = false;
+    }
+
+    bool osaAnalogFilter1394::Step(const double sample)
+    {
+        // FIR, until the history is full the first sample is repeated
+        double filtered = sample;
+        const size_t size = mFIR.size();
+        if (size > 0) {
+            if (mNumberOfSamples == 0) {
+                for (auto & value : mHistory) {
+                    value = sample;
+                }
+            }
+            mHistoryIndex = (mHistoryIndex == 0) ? (size - 1) : (mHistoryIndex - 1);
+            mHistory[mHistoryIndex] = sample;
+            filtered = 0.0;
+            size_t index = mHistoryIndex;
+            for (size_t tap = 0; tap < size; ++tap) {
+                filtered += mFIR[tap] * mHistory[index];
+                index = (index + 1 == size) ? 0 : (index + 1);
+            }
+        }
+
+        // IIR, starts from the first sample
+        if (mNumberOfSamples == 0) {
+            mFiltered = filtered;
+        } else {
+            mFiltered += mIIR * (filtered - mFiltered);
+        }
+        ++mNumberOfSamples;
+
+        // statistics on all filtered samples
+        mWindowCompleted = false;
+        if (mWindow > 0) {
+            if (mWindowCounter == 0) {
+                mWindowMinimum = mFiltered;
+                mWindowMaximum = mFiltered;
+                mWindowSum = 0.0;
+            } else if (mFiltered < mWindowMinimum) {
+                mWindowMinimum = mFiltered;
+            } else if (mFiltered > mWindowMaximum) {
+                mWindowMaximum = mFiltered;
+            }
+            mWindowSum += mFiltered;
+            ++mWindowCounter;
+            if (mWindowCounter == mWindow) {
+                mMinimum = mWindowMinimum;
+                mMaximum = mWindowMaximum;
+                mMean = mWindowSum / mWindow;
+                mWindowCounter = 0;
+                mWindowCompleted = true;
+            }
+        }
+
+        // decimation
+        ++mDecimationCounter;
+        if (mDecimationCounter < mDecimation) {
+            return false;
+        }
+        mDecimationCounter = 0;
+        mValue = mFiltered;
+        return true;
+    }
+
+} // namespace sawRobotIO1394
@@ -0,0 +1,56 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnThrow.h>
+
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+
+#include "AmpIO.h"
+
+using namespace sawRobotIO1394;
+
+void osaBoardSnapshot1394::UseTemperatureForAxis(const int axis)
+{
+    const size_t index = static_cast<size_t>(axis / 2);
+    if (index >= MAX_TEMPERATURES) {
+        cmnThrow("osaBoardSnapshot1394::UseTemperatureForAxis: axis out of range");
+    }
+    if (index >= NumberOfTemperatures) {
+        NumberOfTemperatures = index + 1;
+    }
+}
+
+void osaBoardSnapshot1394::Update(AmpIO & board)
+{
+    Valid = board.ValidRead();
+    PowerEnable = board.GetPowerEnable();
+    PowerStatus = board.GetPowerStatus();
+    PowerFault = board.GetPowerFault();
+    SafetyRelay = board.GetSafetyRelay();
+    SafetyRelayStatus = board.GetSafetyRelayStatus();
+    WatchdogTimeoutStatus = board.GetWatchdogTimeoutStatus();
+    SafetyAmpDisable = board.GetSafetyAmpDisable();
+
+    TimestampSeconds = board.GetTimestampSeconds();
+    FPGATime += TimestampSeconds;
+    DigitalInput = board.GetDigitalInput();
+
+    // board reports temperature in celsius * 2
+    for (size_t index = 0; index < NumberOfTemperatures; ++index) {
+        AmpTemperature[index] = board.GetAmpTemperature(static_cast<unsigned int>(index)) / 2.0;
+    }
+}
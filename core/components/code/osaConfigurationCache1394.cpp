@@ -0,0 +1,366 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <vector>
+
+#include <cisstCommon/cmnPortability.h>
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnDataFunctions.h>
+#include <cisstCommon/cmnDataFunctionsString.h>
+#include <cisstCommon/cmnDataFunctionsVector.h>
+
+#if (CISST_OS != CISST_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <sawRobotIO1394/osaConfigurationCache1394.h>
+
+namespace sawRobotIO1394 {
+
+    namespace {
+
+        // increment when the layout below or osaConfiguration1394.cdg changes
+        const char CacheMagic[8] = {'I', 'O', '1', '3', '9', '4', 'C', 'C'};
+        const uint32_t CacheVersion = 4;
+
+        //! Read only view on a file, memory mapped when possible
+        class FileView {
+        public:
+            ~FileView() {
+#if (CISST_OS != CISST_WINDOWS)
+                if (mMapped) {
+                    munmap(mMapped, mSize);
+                }
+#endif
+            }
+
+            bool Open(const std::string & filename) {
+#if (CISST_OS != CISST_WINDOWS)
+                const int fd = open(filename.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    return false;
+                }
+                struct stat status;
+                if ((fstat(fd, &status) != 0) || (status.st_size == 0)) {
+                    close(fd);
+                    return false;
+                }
+                mSize = status.st_size;
+                void * mapped = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                close(fd);
+                if (mapped == MAP_FAILED) {
+                    return false;
+                }
+                mMapped = mapped;
+                mData = static_cast<const char *>(mapped);
+                return true;
+#else
+                std::ifstream stream(filename.c_str(), std::ios::binary);
+                if (!stream.is_open()) {
+                    return false;
+                }
+                mBuffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+                mSize = mBuffer.size();
+                mData = mBuffer.data();
+                return (mSize != 0);
+#endif
+            }
+
+            const char * Data(void) const {
+                return mData;
+            }
+
+            size_t Size(void) const {
+                return mSize;
+            }
+
+        protected:
+            const char * mData = nullptr;
+            size_t mSize = 0;
+#if (CISST_OS != CISST_WINDOWS)
+            void * mMapped = nullptr;
+#else
+            std::vector<char> mBuffer;
+#endif
+        };
+
+        //! Stream buffer over existing memory, no copy
+        class MemoryBuffer: public std::streambuf {
+        public:
+            MemoryBuffer(const char * data, const size_t size) {
+                char * begin = const_cast<char *>(data);
+                setg(begin, begin, begin + size);
+            }
+        };
+
+        uint64_t HashBuffer(const char * data, const size_t size) {
+            uint64_t hash = 14695981039346656037ULL;
+            for (size_t index = 0; index < size; ++index) {
+                hash ^= static_cast<unsigned char>(data[index]);
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        template <typename _elementType>
+        void Write(std::ostream & stream, const _elementType & value) {
+            cmnData<_elementType>::SerializeBinary(value, stream);
+        }
+
+        template <typename _elementType>
+        void Read(std::istream & stream, _elementType & value) {
+            const cmnDataFormat format;
+            cmnData<_elementType>::DeSerializeBinary(value, stream, format, format);
+        }
+
+        // enums are stored as int
+        template <typename _enumType>
+        void ReadEnum(std::istream & stream, _enumType & value) {
+            int asInt;
+            Read(stream, asInt);
+            value = static_cast<_enumType>(asInt);
+        }
+
+        void WriteRobot(std::ostream & stream, const osaRobot1394Configuration & robot) {
+            Write(stream, robot.Name);
+            Write(stream, static_cast<int>(robot.HardwareVersion));
+            Write(stream, robot.NumberOfActuators);
+            Write(stream, robot.SerialNumber);
+            Write(stream, robot.NumberOfBrakes);
+            Write(stream, robot.OnlyIO);
+            Write(stream, robot.HasEncoderPreload);
+            Write(stream, robot.PotTolerances);
+            Write(stream, robot.PotCoupling);
+            Write(stream, robot.PotLookupTableInterpolation);
+            Write(stream, robot.PotLookupTableFile);
+            // brake is a pointer, actuators can't be saved as a whole
+            Write(stream, robot.Actuators.size());
+            for (const auto & actuator : robot.Actuators) {
+                Write(stream, actuator.BoardID);
+                Write(stream, actuator.AxisID);
+                Write(stream, static_cast<int>(actuator.JointType));
+                Write(stream, actuator.Drive);
+                Write(stream, actuator.Encoder);
+                Write(stream, actuator.Pot);
+                Write(stream, actuator.Brake != nullptr);
+                if (actuator.Brake) {
+                    Write(stream, *(actuator.Brake));
+                }
+            }
+        }
+
+        void ReadRobot(std::istream & stream, osaRobot1394Configuration & robot) {
+            Read(stream, robot.Name);
+            ReadEnum(stream, robot.HardwareVersion);
+            Read(stream, robot.NumberOfActuators);
+            Read(stream, robot.SerialNumber);
+            Read(stream, robot.NumberOfBrakes);
+            Read(stream, robot.OnlyIO);
+            Read(stream, robot.HasEncoderPreload);
+            Read(stream, robot.PotTolerances);
+            Read(stream, robot.PotCoupling);
+            Read(stream, robot.PotLookupTableInterpolation);
+            Read(stream, robot.PotLookupTableFile);
+            size_t numberOfActuators;
+            Read(stream, numberOfActuators);
+            robot.Actuators.resize(numberOfActuators);
+            for (auto & actuator : robot.Actuators) {
+                Read(stream, actuator.BoardID);
+                Read(stream, actuator.AxisID);
+                ReadEnum(stream, actuator.JointType);
+                Read(stream, actuator.Drive);
+                Read(stream, actuator.Encoder);
+                Read(stream, actuator.Pot);
+                bool hasBrake;
+                Read(stream, hasBrake);
+                actuator.Brake = nullptr;
+                if (hasBrake) {
+                    actuator.Brake = new osaAnalogBrake1394Configuration;
+                    Read(stream, *(actuator.Brake));
+                }
+            }
+        }
+
+        void DeleteBrakes(osaPort1394Configuration & config) {
+            for (auto & robot : config.Robots) {
+                for (auto & actuator : robot.Actuators) {
+                    delete actuator.Brake;
+                    actuator.Brake = nullptr;
+                }
+            }
+        }
+
+    } // anonymous namespace
+
+    bool osaConfigurationCache1394HashFile(const std::string & filename,
+                                           uint64_t & hash)
+    {
+        FileView file;
+        if (!file.Open(filename)) {
+            return false;
+        }
+        hash = HashBuffer(file.Data(), file.Size());
+        return true;
+    }
+
+    bool osaConfigurationCache1394Load(const std::string & cacheFile,
+                                       osaPort1394Configuration & config,
+                                       const bool & calibrationMode)
+    {
+        FileView file;
+        if (!file.Open(cacheFile)) {
+            CMN_LOG_INIT_VERBOSE << "osaConfigurationCache1394Load: no cache found in \""
+                                 << cacheFile << "\"" << std::endl;
+            return false;
+        }
+        MemoryBuffer buffer(file.Data(), file.Size());
+        std::istream stream(&buffer);
+
+        try {
+            char magic[sizeof(CacheMagic)];
+            stream.read(magic, sizeof(magic));
+            if (!stream || !std::equal(magic, magic + sizeof(magic), CacheMagic)) {
+                CMN_LOG_INIT_WARNING << "osaConfigurationCache1394Load: \"" << cacheFile
+                                     << "\" is not a configuration cache" << std::endl;
+                return false;
+            }
+            uint32_t version;
+            bool cachedCalibrationMode;
+            Read(stream, version);
+            Read(stream, cachedCalibrationMode);
+            if ((version != CacheVersion) || (cachedCalibrationMode != calibrationMode)) {
+                CMN_LOG_INIT_VERBOSE << "osaConfigurationCache1394Load: cache \"" << cacheFile
+                                     << "\" was created with a different version or calibration mode" << std::endl;
+                return false;
+            }
+
+            // check all dependencies before reading the configuration itself
+            size_t numberOfFiles;
+            Read(stream, numberOfFiles);
+            for (size_t index = 0; index < numberOfFiles; ++index) {
+                std::string filename;
+                uint64_t cachedHash, hash;
+                Read(stream, filename);
+                Read(stream, cachedHash);
+                if (!osaConfigurationCache1394HashFile(filename, hash)
+                    || (hash != cachedHash)) {
+                    CMN_LOG_INIT_VERBOSE << "osaConfigurationCache1394Load: cache \"" << cacheFile
+                                         << "\" is out of date, \"" << filename << "\" has changed" << std::endl;
+                    return false;
+                }
+            }
+
+            size_t numberOfRobots;
+            Read(stream, numberOfRobots);
+            config.Robots.resize(numberOfRobots);
+            for (auto & robot : config.Robots) {
+                ReadRobot(stream, robot);
+            }
+            Read(stream, config.DigitalInputs);
+            Read(stream, config.DigitalOutputs);
+            Read(stream, config.DallasChips);
+            Read(stream, config.AnalogInputs);
+            Read(stream, config.Reflexes);
+        } catch (std::exception & e) {
+            CMN_LOG_INIT_WARNING << "osaConfigurationCache1394Load: failed to read \"" << cacheFile
+                                 << "\": " << e.what() << std::endl;
+            DeleteBrakes(config);
+            config = osaPort1394Configuration();
+            return false;
+        }
+
+        CMN_LOG_INIT_VERBOSE << "osaConfigurationCache1394Load: loaded configuration from cache \""
+                             << cacheFile << "\"" << std::endl;
+        return true;
+    }
+
+    bool osaConfigurationCache1394Save(const std::string & cacheFile,
+                                       const std::string & configFile,
+                                       const osaPort1394Configuration & config,
+                                       const bool & calibrationMode)
+    {
+        // files used to build the configuration
+        std::vector<std::string> files;
+        files.push_back(configFile);
+        for (const auto & robot : config.Robots) {
+            if (!robot.PotLookupTableFile.empty()) {
+                files.push_back(robot.PotLookupTableFile);
+            }
+        }
+
+        std::ostringstream stream(std::ios::binary);
+        try {
+            stream.write(CacheMagic, sizeof(CacheMagic));
+            Write(stream, CacheVersion);
+            Write(stream, calibrationMode);
+            Write(stream, files.size());
+            for (const auto & filename : files) {
+                uint64_t hash;
+                if (!osaConfigurationCache1394HashFile(filename, hash)) {
+                    CMN_LOG_INIT_WARNING << "osaConfigurationCache1394Save: unable to read \""
+                                         << filename << "\", cache not saved" << std::endl;
+                    return false;
+                }
+                Write(stream, filename);
+                Write(stream, hash);
+            }
+            Write(stream, config.Robots.size());
+            for (const auto & robot : config.Robots) {
+                WriteRobot(stream, robot);
+            }
+            Write(stream, config.DigitalInputs);
+            Write(stream, config.DigitalOutputs);
+            Write(stream, config.DallasChips);
+            Write(stream, config.AnalogInputs);
+            Write(stream, config.Reflexes);
+        } catch (std::exception & e) {
+            CMN_LOG_INIT_WARNING << "osaConfigurationCache1394Save: failed to serialize configuration: "
+                                 << e.what() << std::endl;
+            return false;
+        }
+
+        // write to temporary file and rename so a partial file is never used
+        const std::string temporaryFile = cacheFile + ".tmp";
+        std::ofstream output(temporaryFile.c_str(), std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            CMN_LOG_INIT_WARNING << "osaConfigurationCache1394Save: unable to create \""
+                                 << temporaryFile << "\"" << std::endl;
+            return false;
+        }
+        const std::string data = stream.str();
+        output.write(data.data(), data.size());
+        output.close();
+        if (!output || (std::rename(temporaryFile.c_str(), cacheFile.c_str()) != 0)) {
+            CMN_LOG_INIT_WARNING << "osaConfigurationCache1394Save: unable to write \""
+                                 << cacheFile << "\"" << std::endl;
+            std::remove(temporaryFile.c_str());
+            return false;
+        }
+        CMN_LOG_INIT_VERBOSE << "osaConfigurationCache1394Save: saved configuration cache \""
+                             << cacheFile << "\"" << std::endl;
+        return true;
+    }
+
+} // namespace sawRobotIO1394
@@ -0,0 +1,277 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <map>
+#include <sstream>
+
+#include <cisstCommon/cmnDataFunctions.h>
+#include <cisstCommon/cmnDataFunctionsString.h>
+#include <cisstCommon/cmnDataFunctionsVector.h>
+
+#include <sawRobotIO1394/osaConfigurationDiff1394.h>
+
+namespace sawRobotIO1394 {
+
+    namespace {
+
+        //! Compare generated data types using their binary serialization
+        template <typename _elementType>
+        bool SameData(const _elementType & current, const _elementType & next) {
+            std::stringstream currentStream, nextStream;
+            cmnData<_elementType>::SerializeBinary(current, currentStream);
+            cmnData<_elementType>::SerializeBinary(next, nextStream);
+            return currentStream.str() == nextStream.str();
+        }
+
+        bool SameVector(const vctDoubleVec & current, const vctDoubleVec & next) {
+            return (current.size() == next.size())
+                && ((current.size() == 0) || current.Equal(next));
+        }
+
+        bool SameMatrix(const vctDoubleMat & current, const vctDoubleMat & next) {
+            return (current.rows() == next.rows())
+                && (current.cols() == next.cols())
+                && ((current.size() == 0) || current.Equal(next));
+        }
+
+        /*! Elements matched by name, changed if the binary
+          serialization differs */
+        template <typename _configType>
+        void CompareByName(const std::vector<_configType> & current,
+                           const std::vector<_configType> & next,
+                           std::vector<size_t> & changed,
+                           std::vector<size_t> & added,
+                           std::vector<std::string> & removed)
+        {
+            std::map<std::string, const _configType *> currentByName;
+            for (const auto & element : current) {
+                currentByName[element.Name] = &element;
+            }
+            for (size_t index = 0; index < next.size(); ++index) {
+                const auto found = currentByName.find(next.at(index).Name);
+                if (found == currentByName.end()) {
+                    added.push_back(index);
+                } else {
+                    if (!SameData(*(found->second), next.at(index))) {
+                        changed.push_back(index);
+                    }
+                    currentByName.erase(found);
+                }
+            }
+            for (const auto & remaining : currentByName) {
+                removed.push_back(remaining.first);
+            }
+        }
+
+        void IndicesToStream(std::ostream & output, const char * title,
+                             const std::vector<size_t> & indices,
+                             const std::vector<std::string> & names)
+        {
+            if (indices.empty()) {
+                return;
+            }
+            output << "  " << title << ":";
+            for (const auto index : indices) {
+                output << " " << names.at(index);
+            }
+            output << std::endl;
+        }
+
+        void NamesToStream(std::ostream & output, const char * title,
+                           const std::vector<std::string> & names)
+        {
+            if (names.empty()) {
+                return;
+            }
+            output << "  " << title << ":";
+            for (const auto & name : names) {
+                output << " " << name;
+            }
+            output << std::endl;
+        }
+
+        template <typename _configType>
+        std::vector<std::string> Names(const std::vector<_configType> & elements) {
+            std::vector<std::string> names;
+            for (const auto & element : elements) {
+                names.push_back(element.Name);
+            }
+            return names;
+        }
+
+    } // namespace
+
+    bool osaConfigurationDiff1394::Empty(void) const
+    {
+        return RobotsCalibrationChanged.empty()
+            && !RequiresRestart()
+            && DigitalInputsChanged.empty()
+            && DigitalOutputsChanged.empty()
+            && DallasChipsChanged.empty();
+    }
+
+    bool osaConfigurationDiff1394::RequiresRestart(void) const
+    {
+        return !RobotsLayoutChanged.empty()
+            || !RobotsAdded.empty()
+            || !RobotsRemoved.empty()
+            || !DigitalInputsAdded.empty()
+            || !DigitalInputsRemoved.empty()
+            || !DigitalOutputsAdded.empty()
+            || !DigitalOutputsRemoved.empty()
+            || !DallasChipsAdded.empty()
+            || !DallasChipsRemoved.empty()
+            || ReflexesChanged
+            || AnalogInputsChanged;
+    }
+
+    void osaConfigurationDiff1394::Clear(void)
+    {
+        *this = osaConfigurationDiff1394();
+    }
+
+    void osaConfigurationDiff1394::ToStream(std::ostream & output,
+                                            const osaPort1394Configuration & next) const
+    {
+        IndicesToStream(output, "robots with new calibration", RobotsCalibrationChanged, Names(next.Robots));
+        NamesToStream(output, "robots with new layout (restart required)", RobotsLayoutChanged);
+        NamesToStream(output, "robots added (restart required)", RobotsAdded);
+        NamesToStream(output, "robots removed (restart required)", RobotsRemoved);
+        const std::vector<std::string> inputs = Names(next.DigitalInputs);
+        IndicesToStream(output, "digital inputs changed", DigitalInputsChanged, inputs);
+        IndicesToStream(output, "digital inputs added (restart required)", DigitalInputsAdded, inputs);
+        NamesToStream(output, "digital inputs removed (restart required)", DigitalInputsRemoved);
+        const std::vector<std::string> outputs = Names(next.DigitalOutputs);
+        IndicesToStream(output, "digital outputs changed", DigitalOutputsChanged, outputs);
+        IndicesToStream(output, "digital outputs added (restart required)", DigitalOutputsAdded, outputs);
+        NamesToStream(output, "digital outputs removed (restart required)", DigitalOutputsRemoved);
+        const std::vector<std::string> chips = Names(next.DallasChips);
+        IndicesToStream(output, "Dallas chips changed", DallasChipsChanged, chips);
+        IndicesToStream(output, "Dallas chips added (restart required)", DallasChipsAdded, chips);
+        NamesToStream(output, "Dallas chips removed (restart required)", DallasChipsRemoved);
+        if (ReflexesChanged) {
+            output << "  reflex rules changed (restart required)" << std::endl;
+        }
+        if (AnalogInputsChanged) {
+            output << "  analog inputs changed (restart required)" << std::endl;
+        }
+    }
+
+    bool osaConfigurationDiff1394SameLayout(const osaRobot1394Configuration & current,
+                                            const osaRobot1394Configuration & next)
+    {
+        if ((current.HardwareVersion != next.HardwareVersion)
+            || (current.NumberOfActuators != next.NumberOfActuators)
+            || (current.Actuators.size() != next.Actuators.size())
+            || (current.SerialNumber != next.SerialNumber)
+            || (current.OnlyIO != next.OnlyIO)
+            || (current.HasEncoderPreload != next.HasEncoderPreload)
+            || (current.PotLookupTableInterpolation != next.PotLookupTableInterpolation)
+            || (current.PotTolerances.size() != next.PotTolerances.size())
+            || !SameMatrix(current.PotCoupling.JointToActuatorPosition(),
+                           next.PotCoupling.JointToActuatorPosition())) {
+            return false;
+        }
+        for (size_t index = 0; index < current.Actuators.size(); ++index) {
+            const osaActuator1394Configuration & currentActuator = current.Actuators.at(index);
+            const osaActuator1394Configuration & nextActuator = next.Actuators.at(index);
+            if ((currentActuator.BoardID != nextActuator.BoardID)
+                || (currentActuator.AxisID != nextActuator.AxisID)
+                || (currentActuator.JointType != nextActuator.JointType)
+                || (currentActuator.Encoder.VelocitySource != nextActuator.Encoder.VelocitySource)
+                || (currentActuator.Pot.Type != nextActuator.Pot.Type)
+                || !SameVector(currentActuator.Pot.LookupTable, nextActuator.Pot.LookupTable)
+                || ((currentActuator.Brake == nullptr) != (nextActuator.Brake == nullptr))) {
+                return false;
+            }
+            if (currentActuator.Brake
+                && ((currentActuator.Brake->BoardID != nextActuator.Brake->BoardID)
+                    || (currentActuator.Brake->AxisID != nextActuator.Brake->AxisID))) {
+                return false;
+            }
+            if (current.PotTolerances.at(index).WindowSamples != next.PotTolerances.at(index).WindowSamples) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool osaConfigurationDiff1394SameCalibration(const osaRobot1394Configuration & current,
+                                                 const osaRobot1394Configuration & next)
+    {
+        if ((current.Actuators.size() != next.Actuators.size())
+            || !SameData(current.PotTolerances, next.PotTolerances)) {
+            return false;
+        }
+        for (size_t index = 0; index < current.Actuators.size(); ++index) {
+            const osaActuator1394Configuration & currentActuator = current.Actuators.at(index);
+            const osaActuator1394Configuration & nextActuator = next.Actuators.at(index);
+            if (!SameData(currentActuator.Drive, nextActuator.Drive)
+                || !SameData(currentActuator.Encoder, nextActuator.Encoder)
+                || !SameData(currentActuator.Pot.BitsToVoltage, nextActuator.Pot.BitsToVoltage)
+                || !SameData(currentActuator.Pot.SensorToPosition, nextActuator.Pot.SensorToPosition)) {
+                return false;
+            }
+            if (currentActuator.Brake && nextActuator.Brake
+                && !SameData(*(currentActuator.Brake), *(nextActuator.Brake))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void osaConfigurationDiff1394Compute(const osaPort1394Configuration & current,
+                                         const osaPort1394Configuration & next,
+                                         osaConfigurationDiff1394 & diff)
+    {
+        diff.Clear();
+
+        // robots, compared field by field since brakes are pointers
+        std::map<std::string, const osaRobot1394Configuration *> currentRobots;
+        for (const auto & robot : current.Robots) {
+            currentRobots[robot.Name] = &robot;
+        }
+        for (size_t index = 0; index < next.Robots.size(); ++index) {
+            const osaRobot1394Configuration & nextRobot = next.Robots.at(index);
+            const auto found = currentRobots.find(nextRobot.Name);
+            if (found == currentRobots.end()) {
+                diff.RobotsAdded.push_back(nextRobot.Name);
+                continue;
+            }
+            const osaRobot1394Configuration & currentRobot = *(found->second);
+            currentRobots.erase(found);
+            if (!osaConfigurationDiff1394SameLayout(currentRobot, nextRobot)) {
+                diff.RobotsLayoutChanged.push_back(nextRobot.Name);
+            } else if (!osaConfigurationDiff1394SameCalibration(currentRobot, nextRobot)) {
+                diff.RobotsCalibrationChanged.push_back(index);
+            }
+        }
+        for (const auto & remaining : currentRobots) {
+            diff.RobotsRemoved.push_back(remaining.first);
+        }
+
+        CompareByName(current.DigitalInputs, next.DigitalInputs,
+                      diff.DigitalInputsChanged, diff.DigitalInputsAdded, diff.DigitalInputsRemoved);
+        CompareByName(current.DigitalOutputs, next.DigitalOutputs,
+                      diff.DigitalOutputsChanged, diff.DigitalOutputsAdded, diff.DigitalOutputsRemoved);
+        CompareByName(current.DallasChips, next.DallasChips,
+                      diff.DallasChipsChanged, diff.DallasChipsAdded, diff.DallasChipsRemoved);
+        diff.ReflexesChanged = !SameData(current.Reflexes, next.Reflexes);
+        diff.AnalogInputsChanged = !SameData(current.AnalogInputs, next.AnalogInputs);
+    }
+
+} // namespace sawRobotIO1394
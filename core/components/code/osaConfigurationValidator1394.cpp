@@ -0,0 +1,475 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include <cisstCommon/cmnPath.h>
+#include <cisstCommon/cmnUnits.h>
+#include <cisstCommon/cmnXMLPath.h>
+
+#include <sawRobotIO1394/osaConfigurationValidator1394.h>
+#include <sawRobotIO1394/osaXML1394.h>
+#include <sawRobotIO1394/osaJSON1394.h>
+#include <sawRobotIO1394/osaPotLookupTable1394.h>
+#include <sawRobotIO1394/osaAnalogFilter1394.h>
+
+namespace sawRobotIO1394 {
+
+    std::ostream & operator << (std::ostream & output,
+                                const osaConfigurationIssue1394 & issue)
+    {
+        output << issue.File;
+        if (issue.Line != 0) {
+            output << ":" << issue.Line;
+        }
+        output << ": "
+               << ((issue.Severity == osaConfigurationIssue1394::ISSUE_ERROR) ? "error" : "warning")
+               << ": ";
+        if (!issue.Context.empty()) {
+            output << issue.Context << ": ";
+        }
+        output << issue.Message;
+        return output;
+    }
+
+    namespace {
+
+        //! Best effort search of elements in XML or JSON file content
+        class LineFinder {
+        public:
+            LineFinder(const std::string & content, const bool isJSON):
+                mContent(content),
+                mActuatorMarker(isJSON ? "\"JointType\"" : "<Actuator "),
+                mToleranceMarker(isJSON ? "\"WindowSamples\"" : "<Tolerance ")
+            {
+                mLineStarts.push_back(0);
+                for (size_t index = 0; index < mContent.size(); ++index) {
+                    if (mContent[index] == '\n') {
+                        mLineStarts.push_back(index + 1);
+                    }
+                }
+            }
+
+            //! Offset of robot name, npos if not found
+            size_t Robot(const std::string & name) const {
+                const std::string quoted = "\"" + name + "\"";
+                size_t found = mContent.find(quoted);
+                while (found != std::string::npos) {
+                    // make sure this is the robot name, not a value with
+                    // the same content
+                    const size_t lineStart = mContent.rfind('\n', found);
+                    const size_t from = (lineStart == std::string::npos) ? 0 : lineStart;
+                    const size_t nameKey = mContent.find("Name", from);
+                    if ((nameKey != std::string::npos) && (nameKey < found)) {
+                        return found;
+                    }
+                    found = mContent.find(quoted, found + quoted.size());
+                }
+                return std::string::npos;
+            }
+
+            size_t Actuator(const size_t robot, const size_t index) const {
+                return Nth(mActuatorMarker, robot, index);
+            }
+
+            size_t Tolerance(const size_t robot, const size_t index) const {
+                return Nth(mToleranceMarker, robot, index);
+            }
+
+            //! 1 based line number, 0 if not found
+            size_t Line(const size_t offset) const {
+                if (offset == std::string::npos) {
+                    return 0;
+                }
+                return std::upper_bound(mLineStarts.begin(), mLineStarts.end(), offset)
+                    - mLineStarts.begin();
+            }
+
+        protected:
+            size_t Nth(const std::string & marker, const size_t from, const size_t index) const {
+                if (from == std::string::npos) {
+                    return std::string::npos;
+                }
+                size_t found = mContent.find(marker, from);
+                for (size_t count = 0;
+                     (count < index) && (found != std::string::npos);
+                     ++count) {
+                    found = mContent.find(marker, found + marker.size());
+                }
+                return found;
+            }
+
+            const std::string & mContent;
+            const std::string mActuatorMarker, mToleranceMarker;
+            std::vector<size_t> mLineStarts;
+        };
+
+        bool IsJSON(const std::string & filename) {
+            const std::string extension = ".json";
+            return (filename.size() > extension.size())
+                && (filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0);
+        }
+
+        //! Helper to add issues with common file and line lookup
+        class IssueList {
+        public:
+            IssueList(const std::string & filename,
+                      const LineFinder & finder,
+                      std::vector<osaConfigurationIssue1394> & issues):
+                mFilename(filename),
+                mFinder(finder),
+                mIssues(issues)
+            {}
+
+            void Add(const osaConfigurationIssue1394::SeverityType severity,
+                     const size_t offset,
+                     const std::string & context,
+                     const std::string & message) {
+                osaConfigurationIssue1394 issue;
+                issue.Severity = severity;
+                issue.File = mFilename;
+                issue.Line = mFinder.Line(offset);
+                issue.Context = context;
+                issue.Message = message;
+                mIssues.push_back(issue);
+                if (severity == osaConfigurationIssue1394::ISSUE_ERROR) {
+                    mHasErrors = true;
+                }
+            }
+
+            void Error(const size_t offset, const std::string & context, const std::string & message) {
+                Add(osaConfigurationIssue1394::ISSUE_ERROR, offset, context, message);
+            }
+
+            void Warning(const size_t offset, const std::string & context, const std::string & message) {
+                Add(osaConfigurationIssue1394::ISSUE_WARNING, offset, context, message);
+            }
+
+            bool HasErrors(void) const {
+                return mHasErrors;
+            }
+
+        protected:
+            const std::string & mFilename;
+            const LineFinder & mFinder;
+            std::vector<osaConfigurationIssue1394> & mIssues;
+            bool mHasErrors = false;
+        };
+
+        void CheckUnit(IssueList & issues, const size_t offset, const std::string & context,
+                       const cmnJointType & type, const std::string & unit, const char * name)
+        {
+            if ((type == CMN_JOINT_REVOLUTE) && !osaUnitIsDistanceRevolute(unit)) {
+                issues.Error(offset, context, std::string(name) + " unit must be rad or deg for a revolute joint but found \""
+                             + unit + "\"");
+            } else if ((type == CMN_JOINT_PRISMATIC) && !osaUnitIsDistancePrismatic(unit)) {
+                issues.Error(offset, context, std::string(name) + " unit must be mm, cm or m for a prismatic joint but found \""
+                             + unit + "\"");
+            }
+        }
+
+        //! Same checks as osaXML1394ConfigureRobot, all reported
+        void CheckXMLLookupTables(const std::string & filename,
+                                  const osaPort1394Configuration & config,
+                                  const LineFinder & finder,
+                                  IssueList & issues)
+        {
+            cmnXMLPath xmlConfig;
+            xmlConfig.SetInputSource(filename);
+            cmnPath configPath(cmnPath::GetWorkingDirectory());
+            configPath.Add(filename.substr(0, filename.find_last_of('/')), cmnPath::HEAD);
+
+            char path[256];
+            for (size_t robotIndex = 0; robotIndex < config.Robots.size(); ++robotIndex) {
+                const osaRobot1394Configuration & robot = config.Robots.at(robotIndex);
+                const std::string context = "Robot[" + std::to_string(robotIndex) + "] " + robot.Name;
+                const size_t offset = finder.Robot(robot.Name);
+                std::string lookupFile;
+                sprintf(path, "Robot[%d]/Potentiometers/@LookupTable", static_cast<int>(robotIndex + 1));
+                if (!xmlConfig.GetXMLValue("Config", path, lookupFile)) {
+                    continue;
+                }
+                if (robot.SerialNumber.empty()) {
+                    issues.Error(offset, context, "serial number must be defined to use a potentiometer lookup table");
+                } else if (lookupFile.find(robot.SerialNumber) == std::string::npos) {
+                    issues.Error(offset, context, "lookup table file name \"" + lookupFile
+                                 + "\" doesn't contain the serial number (" + robot.SerialNumber + ")");
+                }
+                const std::string fullPath = configPath.Find(lookupFile);
+                if (fullPath.empty()) {
+                    issues.Error(offset, context, "unable to find lookup table file \"" + lookupFile + "\"");
+                    continue;
+                }
+                std::vector<vctDoubleVec> rows(robot.Actuators.size());
+                std::vector<vctDoubleVec *> tables;
+                for (auto & row : rows) {
+                    tables.push_back(&row);
+                }
+                std::string inFileSerial, errorMessage;
+                if (!osaPotLookupTable1394ReadFile(fullPath, inFileSerial, tables, errorMessage)) {
+                    issues.Error(offset, context, errorMessage);
+                    continue;
+                }
+                if (inFileSerial != robot.SerialNumber) {
+                    issues.Error(offset, context, "serial number in lookup table file (" + inFileSerial
+                                 + ") doesn't match the robot one (" + robot.SerialNumber + ")");
+                }
+            }
+        }
+
+    } // namespace
+
+    bool osaConfigurationValidator1394CheckPort(const osaPort1394Configuration & config,
+                                                const std::string & filename,
+                                                const std::string & fileContent,
+                                                std::vector<osaConfigurationIssue1394> & issues)
+    {
+        const LineFinder finder(fileContent, IsJSON(filename));
+        IssueList list(filename, finder, issues);
+
+        // board/axis used by each actuator or brake, across all robots
+        std::map<std::pair<int, int>, std::string> axesUsed;
+        // board/axis used by each actuator's pot, analog inputs can't use them
+        std::map<std::pair<int, int>, std::string> potsUsed;
+
+        for (size_t robotIndex = 0; robotIndex < config.Robots.size(); ++robotIndex) {
+            const osaRobot1394Configuration & robot = config.Robots.at(robotIndex);
+            const std::string robotContext = "Robot[" + std::to_string(robotIndex) + "] " + robot.Name;
+            const size_t robotOffset = finder.Robot(robot.Name);
+
+            if (robot.Actuators.size() != static_cast<size_t>(robot.NumberOfActuators)) {
+                list.Error(robotOffset, robotContext, "NumberOfActuators is " + std::to_string(robot.NumberOfActuators)
+                           + " but found " + std::to_string(robot.Actuators.size()) + " actuators");
+            }
+
+            int potType = -1;
+            size_t lookupTableSize = 0;
+            for (size_t index = 0; index < robot.Actuators.size(); ++index) {
+                const osaActuator1394Configuration & actuator = robot.Actuators.at(index);
+                const std::string context = robotContext + "/Actuator[" + std::to_string(index) + "]";
+                const size_t offset = finder.Actuator(robotOffset, index);
+
+                // board and axis
+                if ((actuator.BoardID < 0) || (actuator.BoardID >= static_cast<int>(MAX_BOARDS))
+                    || (actuator.AxisID < 0) || (actuator.AxisID >= static_cast<int>(MAX_AXES))) {
+                    list.Error(offset, context, "invalid board " + std::to_string(actuator.BoardID)
+                               + " or axis " + std::to_string(actuator.AxisID));
+                }
+                const auto axis = std::make_pair(actuator.BoardID, actuator.AxisID);
+                const auto used = axesUsed.find(axis);
+                if (used != axesUsed.end()) {
+                    list.Error(offset, context, "board " + std::to_string(actuator.BoardID)
+                               + " axis " + std::to_string(actuator.AxisID) + " already used by " + used->second);
+                } else {
+                    axesUsed[axis] = context;
+                }
+                potsUsed[axis] = context;
+                if (actuator.Brake) {
+                    const auto brakeAxis = std::make_pair(actuator.Brake->BoardID, actuator.Brake->AxisID);
+                    const auto brakeUsed = axesUsed.find(brakeAxis);
+                    if (brakeUsed != axesUsed.end()) {
+                        list.Error(offset, context, "brake board " + std::to_string(actuator.Brake->BoardID)
+                                   + " axis " + std::to_string(actuator.Brake->AxisID) + " already used by " + brakeUsed->second);
+                    } else {
+                        axesUsed[brakeAxis] = context + "/Brake";
+                    }
+                }
+
+                // units vs joint types, not used for IO only robots
+                if (!robot.OnlyIO) {
+                    CheckUnit(list, offset, context, actuator.JointType,
+                              actuator.Encoder.BitsToPosition.Unit, "Encoder/BitsToPosition");
+                    CheckUnit(list, offset, context, actuator.JointType,
+                              actuator.Encoder.PositionLimitsSoft.Unit, "Encoder/PositionLimitsSoft");
+                    if (actuator.Pot.Type == 1) {
+                        CheckUnit(list, offset, context, actuator.JointType,
+                                  actuator.Pot.SensorToPosition.Unit, "Pot/SensorToPosition");
+                    }
+                    if (actuator.Drive.EffortToCurrent.Scale == 0.0) {
+                        list.Error(offset, context, "Drive/EffortToCurrent scale can't be zero");
+                    }
+                }
+
+                // pots, same rules as mtsRobot1394::Configure
+                if (potType == -1) {
+                    potType = actuator.Pot.Type;
+                } else if ((actuator.Pot.Type != 0) && (actuator.Pot.Type != potType)) {
+                    list.Error(offset, context, "all potentiometers must be either analog or digital");
+                }
+                if (actuator.Pot.Type == 2) {
+                    if (actuator.Pot.LookupTable.size() == 0) {
+                        list.Error(offset, context, "uses a lookup table for potentiometers but the table is empty");
+                    } else if (lookupTableSize == 0) {
+                        lookupTableSize = actuator.Pot.LookupTable.size();
+                    } else if (actuator.Pot.LookupTable.size() != lookupTableSize) {
+                        list.Warning(offset, context, "lookup table size (" + std::to_string(actuator.Pot.LookupTable.size())
+                                     + ") differs from previous actuators (" + std::to_string(lookupTableSize) + ")");
+                    }
+                }
+            }
+
+            // equal current offsets, see mtsRobot1394::CheckConfiguration
+            if ((robot.HardwareVersion != osa1394::dRA1)
+                && (robot.Actuators.size() > 2)) {
+                const double offset0 = robot.Actuators.at(0).Drive.CurrentToBits.Offset;
+                bool allEqual = true;
+                for (const auto & actuator : robot.Actuators) {
+                    allEqual &= (actuator.Drive.CurrentToBits.Offset == offset0);
+                }
+                if (allEqual) {
+                    list.Error(robotOffset, robotContext, "all currents to bits offsets are equal, please calibrate the current offsets");
+                }
+            }
+
+            // pot tolerances
+            if (robot.PotTolerances.size() != robot.Actuators.size()) {
+                list.Error(robotOffset, robotContext, "number of pot tolerances (" + std::to_string(robot.PotTolerances.size())
+                           + ") doesn't match the number of actuators (" + std::to_string(robot.Actuators.size()) + ")");
+            }
+            for (size_t index = 0; index < robot.PotTolerances.size(); ++index) {
+                const osaPotTolerance1394Configuration & tolerance = robot.PotTolerances.at(index);
+                const std::string context = robotContext + "/Tolerance[" + std::to_string(index) + "]";
+                const size_t offset = finder.Tolerance(robotOffset, index);
+                if (tolerance.WindowSamples < 1) {
+                    list.Error(offset, context, "WindowSamples must be at least 1");
+                }
+                if ((tolerance.Distance == 0.0) || (tolerance.Latency == 0.0)) {
+                    list.Warning(offset, context, "distance and/or latency set to zero, safety check is disabled");
+                }
+            }
+        }
+
+        // reflex rules, same checks as mtsRobotIO1394::AddReflex
+        std::set<std::string> inputs, outputs, robots;
+        for (const auto & input : config.DigitalInputs) {
+            inputs.insert(input.Name);
+        }
+        for (const auto & output : config.DigitalOutputs) {
+            outputs.insert(output.Name);
+        }
+        for (const auto & robot : config.Robots) {
+            robots.insert(robot.Name);
+        }
+        for (size_t index = 0; index < config.Reflexes.size(); ++index) {
+            const osaReflex1394Configuration & reflex = config.Reflexes.at(index);
+            const std::string context = "Reflex[" + std::to_string(index) + "]";
+            if (inputs.count(reflex.Input) == 0) {
+                list.Error(std::string::npos, context, "unknown digital input \"" + reflex.Input + "\"");
+            }
+            if (!reflex.Output.empty() && (outputs.count(reflex.Output) == 0)) {
+                list.Error(std::string::npos, context, "unknown digital output \"" + reflex.Output + "\"");
+            }
+            if (!reflex.PowerOff.empty() && (robots.count(reflex.PowerOff) == 0)) {
+                list.Error(std::string::npos, context, "unknown robot \"" + reflex.PowerOff + "\"");
+            }
+            if (reflex.Output.empty() && reflex.PowerOff.empty()) {
+                list.Error(std::string::npos, context, "no Output nor PowerOff action");
+            }
+        }
+
+        // analog inputs, same checks as mtsAnalogInput1394::Configure
+        std::set<std::string> analogInputs;
+        for (size_t index = 0; index < config.AnalogInputs.size(); ++index) {
+            const osaAnalogInput1394Configuration & analogInput = config.AnalogInputs.at(index);
+            const std::string context = "AnalogInput[" + std::to_string(index) + "]";
+            if (!analogInputs.insert(analogInput.Name).second) {
+                list.Error(std::string::npos, context, "analog input name \"" + analogInput.Name + "\" is not unique");
+            }
+            if ((analogInput.AxisID < 0) || (analogInput.AxisID >= static_cast<int>(MAX_AXES))) {
+                list.Error(std::string::npos, context, "AxisID must be between 0 and " + std::to_string(MAX_AXES - 1));
+            }
+            const auto pot = potsUsed.find(std::make_pair(analogInput.BoardID, analogInput.AxisID));
+            if (pot != potsUsed.end()) {
+                list.Error(std::string::npos, context, "board " + std::to_string(analogInput.BoardID)
+                           + " axis " + std::to_string(analogInput.AxisID) + " already used for the pot of " + pot->second);
+            }
+            osaAnalogFilter1394 filter;
+            std::string message;
+            if (!filter.Configure(std::vector<double>(analogInput.FIR.begin(), analogInput.FIR.end()),
+                                  analogInput.IIR, analogInput.Decimation, analogInput.Window,
+                                  message)) {
+                list.Error(std::string::npos, context, message);
+            }
+        }
+
+        return !list.HasErrors();
+    }
+
+    bool osaConfigurationValidator1394Check(const std::string & filename,
+                                            std::vector<osaConfigurationIssue1394> & issues)
+    {
+        std::ifstream stream(filename.c_str(), std::ios::binary);
+        if (!stream) {
+            osaConfigurationIssue1394 issue;
+            issue.Severity = osaConfigurationIssue1394::ISSUE_ERROR;
+            issue.File = filename;
+            issue.Line = 0;
+            issue.Message = "unable to open file";
+            issues.push_back(issue);
+            return false;
+        }
+        std::stringstream content;
+        content << stream.rdbuf();
+        const std::string fileContent = content.str();
+
+        // XML lookup tables are in separate files, use calibration mode
+        // to skip them so all other problems can be found and check
+        // them separately.  The XML parser is tolerant so elements
+        // with errors are still checked.  JSON files contain the
+        // tables.
+        osaPort1394Configuration config;
+        const bool isJSON = IsJSON(filename);
+        const bool parsed = isJSON ?
+            osaJSON1394LoadPort(filename, config, false)
+            : osaXML1394LoadPort(filename, config, true, true);
+        if (!parsed && isJSON) {
+            osaConfigurationIssue1394 issue;
+            issue.Severity = osaConfigurationIssue1394::ISSUE_ERROR;
+            issue.File = filename;
+            issue.Line = 0;
+            issue.Message = "failed to parse configuration, see log for details";
+            issues.push_back(issue);
+            return false;
+        }
+
+        const size_t previousIssues = issues.size();
+        bool good = osaConfigurationValidator1394CheckPort(config, filename, fileContent, issues);
+        if (!isJSON) {
+            const LineFinder finder(fileContent, false);
+            IssueList list(filename, finder, issues);
+            CheckXMLLookupTables(filename, config, finder, list);
+            good &= !list.HasErrors();
+        }
+        // errors only found by the parser, e.g. missing values or
+        // version
+        if (!parsed && good) {
+            osaConfigurationIssue1394 issue;
+            issue.Severity = osaConfigurationIssue1394::ISSUE_ERROR;
+            issue.File = filename;
+            issue.Line = 0;
+            issue.Message = "parser reported errors, see log for details";
+            issues.insert(issues.begin() + previousIssues, issue);
+            good = false;
+        }
+        return good;
+    }
+
+} // namespace sawRobotIO1394
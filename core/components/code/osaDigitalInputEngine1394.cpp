@@ -0,0 +1,98 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <utility>
+
+#include <cisstCommon/cmnThrow.h>
+
+#include <sawRobotIO1394/osaDigitalInputEngine1394.h>
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+#include <sawRobotIO1394/mtsDigitalInput1394.h>
+
+using namespace sawRobotIO1394;
+
+void osaDigitalInputEngine1394::Clear(void)
+{
+    mBoards.clear();
+    mPolled.clear();
+    mNumberOfInputs = 0;
+}
+
+void osaDigitalInputEngine1394::Add(mtsDigitalInput1394 * input)
+{
+    Add(input, input->BoardSnapshot(), input->BitMask());
+}
+
+void osaDigitalInputEngine1394::Add(mtsDigitalInput1394 * input,
+                                    const osaBoardSnapshot1394 * snapshot,
+                                    const uint32_t bitMask)
+{
+    if (snapshot == nullptr) {
+        cmnThrow("osaDigitalInputEngine1394::Add: " + input->Name() + " has no board snapshot");
+    }
+    size_t boardIndex = 0;
+    while ((boardIndex < mBoards.size())
+           && (mBoards[boardIndex].Snapshot != snapshot)) {
+        ++boardIndex;
+    }
+    if (boardIndex == mBoards.size()) {
+        mBoards.push_back({snapshot, 0, 0, {}});
+    }
+    Board & board = mBoards[boardIndex];
+    board.Inputs.push_back(input);
+    // always update a new input on the first cycle
+    board.ActiveMask |= bitMask;
+    ++mNumberOfInputs;
+    mPolled.reserve(mNumberOfInputs);
+}
+
+void osaDigitalInputEngine1394::Swap(osaDigitalInputEngine1394 & other)
+{
+    mBoards.swap(other.mBoards);
+    mPolled.swap(other.mPolled);
+    std::swap(mNumberOfInputs, other.mNumberOfInputs);
+}
+
+void osaDigitalInputEngine1394::PollState(void)
+{
+    mPolled.clear();
+    for (auto & board : mBoards) {
+        const uint32_t bits = board.Snapshot->DigitalInput;
+        const uint32_t work = (bits ^ board.PreviousBits) | board.ActiveMask;
+        board.PreviousBits = bits;
+        board.ActiveMask = 0;
+        if (work == 0) {
+            continue;
+        }
+        for (auto input : board.Inputs) {
+            if (input->BitMask() & work) {
+                input->PollState(*(board.Snapshot));
+                mPolled.push_back(input);
+                if (input->Busy()) {
+                    board.ActiveMask |= input->BitMask();
+                }
+            }
+        }
+    }
+}
+
+void osaDigitalInputEngine1394::CheckState(void)
+{
+    for (auto input : mPolled) {
+        input->CheckState();
+    }
+}
@@ -0,0 +1,146 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawRobotIO1394/osaDigitalInputHistory1394.h>
+
+namespace sawRobotIO1394 {
+
+    void osaDigitalInputHistory1394::SetCapacity(const size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCapacity = capacity;
+        mEntries.resize(capacity);
+        mNext = 0;
+        mSize = 0;
+        mOverwritten = false;
+        mLost = false;
+        mLostTime = 0.0;
+        mLastTime = 0.0;
+        mHasLastWord = false;
+        mNumberOfPending = 0;
+        mPendingLost = false;
+    }
+
+    size_t osaDigitalInputHistory1394::Capacity(void) const
+    {
+        return mCapacity;
+    }
+
+    void osaDigitalInputHistory1394::Clear(void)
+    {
+        SetCapacity(Capacity());
+    }
+
+    void osaDigitalInputHistory1394::Update(const double time, const uint32_t word)
+    {
+        if (mCapacity == 0) {
+            return;
+        }
+        if (!mHasLastWord || (word != mLastWord)) {
+            mHasLastWord = true;
+            mLastWord = word;
+            if (mNumberOfPending < PENDING_SIZE) {
+                ++mNumberOfPending;
+            } else {
+                // buffer full, replace the newest so the history ends
+                // with the current word
+                mPendingLost = true;
+                mPendingLostTime = time;
+            }
+            mPending[mNumberOfPending - 1] = {time, word};
+        }
+
+        // don't wait for queries, pending words are added next time
+        std::unique_lock<std::mutex> lock(mMutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return;
+        }
+        for (size_t index = 0; index < mNumberOfPending; ++index) {
+            Add(mPending[index]);
+        }
+        mNumberOfPending = 0;
+        if (mPendingLost) {
+            mLost = true;
+            mLostTime = mPendingLostTime;
+            mPendingLost = false;
+        }
+        mLastTime = time;
+    }
+
+    void osaDigitalInputHistory1394::Add(const Entry & entry)
+    {
+        mEntries[mNext] = entry;
+        mNext = (mNext + 1 == mCapacity) ? 0 : (mNext + 1);
+        if (mSize < mCapacity) {
+            ++mSize;
+        } else {
+            mOverwritten = true;
+        }
+    }
+
+    bool osaDigitalInputHistory1394::Edges(const uint32_t mask, const double since,
+                                           std::vector<double> & times, std::vector<bool> & values,
+                                           double & lastTime) const
+    {
+        times.clear();
+        values.clear();
+
+        // allocate outside the lock, capacity only changes when configured
+        std::vector<Entry> entries(Capacity());
+        size_t size;
+        bool overwritten, lost;
+        double lostTime;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            lastTime = mLastTime;
+            size = mSize;
+            overwritten = mOverwritten;
+            lost = mLost;
+            lostTime = mLostTime;
+            const size_t capacity = mEntries.size();
+            // capacity changed in between, history has been cleared anyway
+            if (size > entries.size()) {
+                size = 0;
+            }
+            // copy oldest first
+            size_t index = (size == 0) ? 0 : ((mNext + capacity - size) % capacity);
+            for (size_t count = 0; count < size; ++count) {
+                entries[count] = mEntries[index];
+                index = (index + 1 == capacity) ? 0 : (index + 1);
+            }
+        }
+        if (size == 0) {
+            return true;
+        }
+
+        // the oldest word is a reference, not an edge
+        const bool complete = (!overwritten || (since >= entries[0].Time))
+            && (!lost || (since >= lostTime));
+        uint32_t previous = entries[0].Word & mask;
+        for (size_t index = 1; index < size; ++index) {
+            const Entry & entry = entries[index];
+            const uint32_t current = entry.Word & mask;
+            if ((current != previous) && (entry.Time > since)) {
+                times.push_back(entry.Time);
+                values.push_back(current != 0);
+            }
+            previous = current;
+        }
+        return complete;
+    }
+
+} // namespace sawRobotIO1394
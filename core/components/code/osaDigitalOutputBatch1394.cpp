@@ -0,0 +1,35 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawRobotIO1394/osaDigitalOutputBatch1394.h>
+
+#include "AmpIO.h"
+
+namespace sawRobotIO1394 {
+
+    bool osaDigitalOutputBatch1394::Flush(AmpIO & board)
+    {
+        if (!Pending()) {
+            return true;
+        }
+        // the mask selects the bits written, no need to read current outputs
+        const bool result = board.WriteDigitalOutput(SetMask | ClearMask, SetMask);
+        Clear();
+        return result;
+    }
+
+} // namespace sawRobotIO1394
@@ -0,0 +1,107 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+
+#include <sawRobotIO1394/osaDigitalOutputSequencer1394.h>
+
+namespace sawRobotIO1394 {
+
+    bool osaDigitalOutputSequencer1394::Start(const osaDigitalOutputSequence1394 & sequence,
+                                              std::string & message)
+    {
+        if (sequence.Durations.size() == 0) {
+            message = "sequence is empty";
+            return false;
+        }
+        if (sequence.Durations.size() != sequence.Values.size()) {
+            message = "number of durations and values don't match";
+            return false;
+        }
+        double period = 0.0;
+        for (size_t index = 0; index < sequence.Durations.size(); ++index) {
+            if (!(sequence.Durations.at(index) > 0.0)) {
+                message = "durations must be strictly positive";
+                return false;
+            }
+            period += sequence.Durations.at(index);
+        }
+        mSequence = sequence;
+        mPeriod = period;
+        mPlaying = true;
+        mFirstStep = true;
+        mIndex = 0;
+        mRepetition = 0;
+        mTimeInStep = 0.0;
+        return true;
+    }
+
+    void osaDigitalOutputSequencer1394::Stop(void)
+    {
+        mPlaying = false;
+    }
+
+    bool osaDigitalOutputSequencer1394::Step(const double elapsedTime, double & value)
+    {
+        if (!mPlaying) {
+            return false;
+        }
+        if (mFirstStep) {
+            mFirstStep = false;
+            value = mSequence.Values.at(0);
+            return true;
+        }
+        mTimeInStep += elapsedTime;
+        // skip whole repetitions, we end up on the same step
+        if (mTimeInStep >= mPeriod) {
+            const double repetitions = std::floor(mTimeInStep / mPeriod);
+            mTimeInStep -= repetitions * mPeriod;
+            if (mSequence.Repeat != 0) {
+                if (repetitions >= static_cast<double>(mSequence.Repeat - mRepetition)) {
+                    mPlaying = false;
+                    mIndex = mSequence.Durations.size() - 1;
+                    return false;
+                }
+                mRepetition += static_cast<unsigned int>(repetitions);
+            }
+        }
+        const size_t previousIndex = mIndex;
+        bool wrapped = false;
+        // multiple steps can end during a single cycle, at most one
+        // repetition left
+        while (mTimeInStep >= mSequence.Durations.at(mIndex)) {
+            mTimeInStep -= mSequence.Durations.at(mIndex);
+            ++mIndex;
+            if (mIndex == mSequence.Durations.size()) {
+                ++mRepetition;
+                if ((mSequence.Repeat != 0) && (mRepetition >= mSequence.Repeat)) {
+                    mPlaying = false;
+                    mIndex = mSequence.Durations.size() - 1;
+                    return false;
+                }
+                mIndex = 0;
+                wrapped = true;
+            }
+        }
+        if ((mIndex == previousIndex) && !wrapped) {
+            return false;
+        }
+        value = mSequence.Values.at(mIndex);
+        return true;
+    }
+
+} // namespace sawRobotIO1394
@@ -0,0 +1,263 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <fstream>
+
+#include <sawRobotIO1394/osaJSON1394.h>
+
+namespace sawRobotIO1394 {
+
+    void osaJSON1394ConfigurePort(const std::string & filename,
+                                  osaPort1394Configuration & config,
+                                  const bool & calibrationMode)
+    {
+        if (!osaJSON1394LoadPort(filename, config, calibrationMode)) {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    bool osaJSON1394LoadPort(const std::string & filename,
+                             osaPort1394Configuration & config,
+                             const bool & calibrationMode)
+    {
+        std::ifstream jsonStream;
+        Json::Value jsonConfig;
+        Json::Reader jsonReader;
+
+        jsonStream.open(filename.c_str());
+        if (!jsonStream.is_open()) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394LoadPort: unable to open file \""
+                               << filename << "\"" << std::endl;
+            return false;
+        }
+        if (!jsonReader.parse(jsonStream, jsonConfig)) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394LoadPort: error found while parsing \""
+                               << filename << "\":" << std::endl
+                               << jsonReader.getFormattedErrorMessages();
+            return false;
+        }
+
+        // robots
+        const Json::Value & jsonRobots = jsonConfig["Robots"];
+        config.Robots.resize(jsonRobots.size());
+        for (Json::ArrayIndex index = 0; index < jsonRobots.size(); ++index) {
+            std::string context = "Robots[" + std::to_string(index) + "]";
+            if (!osaJSON1394ConfigureRobot(jsonRobots[index], context,
+                                           config.Robots.at(index), calibrationMode)) {
+                CMN_LOG_INIT_WARNING << "osaJSON1394LoadPort: failed to configure robot from file \""
+                                     << filename << "\"" << std::endl;
+                return false;
+            }
+        }
+
+        // digital inputs, outputs and Dallas chips don't need any extra checks
+        bool good = true;
+        good &= osaJSON1394GetValue(jsonConfig, filename, "DigitalInputs", config.DigitalInputs, false);
+        good &= osaJSON1394GetValue(jsonConfig, filename, "DigitalOutputs", config.DigitalOutputs, false);
+        good &= osaJSON1394GetValue(jsonConfig, filename, "DallasChips", config.DallasChips, false);
+        if (!good) {
+            return false;
+        }
+
+        // reflexes, parsed member by member so optional members keep their defaults
+        const Json::Value & jsonReflexes = jsonConfig["Reflexes"];
+        config.Reflexes.resize(jsonReflexes.size());
+        for (Json::ArrayIndex index = 0; index < jsonReflexes.size(); ++index) {
+            std::string context = "Reflexes[" + std::to_string(index) + "]";
+            if (!osaJSON1394ConfigureReflex(jsonReflexes[index], context,
+                                            config.Reflexes.at(index))) {
+                CMN_LOG_INIT_WARNING << "osaJSON1394LoadPort: failed to configure reflex rule from file \""
+                                     << filename << "\"" << std::endl;
+                return false;
+            }
+        }
+
+        // analog inputs, same as reflexes for default filter settings
+        const Json::Value & jsonAnalogInputs = jsonConfig["AnalogInputs"];
+        config.AnalogInputs.resize(jsonAnalogInputs.size());
+        for (Json::ArrayIndex index = 0; index < jsonAnalogInputs.size(); ++index) {
+            std::string context = "AnalogInputs[" + std::to_string(index) + "]";
+            if (!osaJSON1394ConfigureAnalogInput(jsonAnalogInputs[index], context,
+                                                 config.AnalogInputs.at(index))) {
+                CMN_LOG_INIT_WARNING << "osaJSON1394LoadPort: failed to configure analog input from file \""
+                                     << filename << "\"" << std::endl;
+                return false;
+            }
+        }
+
+        // Check to make sure something was found
+        if ((config.Robots.size() + config.DigitalInputs.size()
+             + config.DigitalOutputs.size() + config.DallasChips.size()
+             + config.AnalogInputs.size()) == 0) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394LoadPort: file " << filename
+                               << " doesn't contain any Robots, DigitalInputs, DigitalOutputs, DallasChips or AnalogInputs" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool osaJSON1394ConfigureRobot(const Json::Value & jsonRobot,
+                                   const std::string & context,
+                                   osaRobot1394Configuration & robot,
+                                   const bool & calibrationMode)
+    {
+        bool good = true;
+
+        good &= osaJSON1394GetValue(jsonRobot, context, "Name", robot.Name);
+        good &= osaJSON1394GetValue(jsonRobot, context, "HardwareVersion", robot.HardwareVersion);
+        good &= osaJSON1394GetValue(jsonRobot, context, "NumberOfActuators", robot.NumberOfActuators);
+        good &= osaJSON1394GetValue(jsonRobot, context, "SerialNumber", robot.SerialNumber, false);
+        good &= osaJSON1394GetValue(jsonRobot, context, "OnlyIO", robot.OnlyIO, false);
+        good &= osaJSON1394GetValue(jsonRobot, context, "HasEncoderPreload", robot.HasEncoderPreload, false);
+        good &= osaJSON1394GetValue(jsonRobot, context, "PotLookupTableInterpolation", robot.PotLookupTableInterpolation, false);
+        good &= osaJSON1394GetValue(jsonRobot, context, "PotCoupling", robot.PotCoupling, false);
+        if (!good) {
+            return false;
+        }
+
+        // actuators, brakes are counted as found
+        const Json::Value & jsonActuators = jsonRobot["Actuators"];
+        if (jsonActuators.size() != static_cast<Json::ArrayIndex>(robot.NumberOfActuators)) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394ConfigureRobot: " << context << " NumberOfActuators is "
+                               << robot.NumberOfActuators << " but found " << jsonActuators.size()
+                               << " actuators for robot " << robot.Name << std::endl;
+            return false;
+        }
+        robot.NumberOfBrakes = 0;
+        robot.Actuators.resize(jsonActuators.size());
+        for (Json::ArrayIndex index = 0; index < jsonActuators.size(); ++index) {
+            osaActuator1394Configuration & actuator = robot.Actuators.at(index);
+            const std::string actuatorContext = context + "/Actuators[" + std::to_string(index) + "]";
+            if (!osaJSON1394ConfigureActuator(jsonActuators[index], actuatorContext,
+                                              robot.OnlyIO, actuator)) {
+                return false;
+            }
+            if (actuator.Brake) {
+                robot.NumberOfBrakes++;
+            }
+            // lookup tables are ignored in calibration mode, see osaXML1394ConfigureRobot
+            if (calibrationMode && (actuator.Pot.Type == 2)) {
+                actuator.Pot.Type = 0;
+                actuator.Pot.LookupTable.SetSize(0);
+            }
+            if ((actuator.Pot.Type == 2) && (actuator.Pot.LookupTable.size() == 0)) {
+                CMN_LOG_INIT_ERROR << "osaJSON1394ConfigureRobot: " << actuatorContext
+                                   << " uses a lookup table for potentiometers but the table is empty for robot "
+                                   << robot.Name << std::endl;
+                return false;
+            }
+        }
+
+        // pot tolerances, one per actuator
+        good &= osaJSON1394GetValue(jsonRobot, context, "PotTolerances", robot.PotTolerances);
+        if (robot.PotTolerances.size() != robot.Actuators.size()) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394ConfigureRobot: " << context << " number of PotTolerances ("
+                               << robot.PotTolerances.size() << ") doesn't match the number of actuators for robot "
+                               << robot.Name << std::endl;
+            return false;
+        }
+        for (const auto & pot : robot.PotTolerances) {
+            if (pot.WindowSamples < 1) {
+                CMN_LOG_INIT_ERROR << "osaJSON1394ConfigureRobot: " << context << " invalid PotTolerances WindowSamples, must be at least 1 but found "
+                                   << pot.WindowSamples << " for Axis " << pot.AxisID << " for robot "
+                                   << robot.Name << std::endl;
+                good = false;
+            }
+            if ((pot.Distance == 0.0) || (pot.Latency == 0.0)) {
+                CMN_LOG_INIT_WARNING << "osaJSON1394ConfigureRobot: potentiometer to encoder latency ("
+                                     << pot.Latency << ") and/or distance ("
+                                     << pot.Distance << ") set to zero, safety check is DISABLED for Axis "
+                                     << pot.AxisID << " for robot " << robot.Name << std::endl;
+            }
+        }
+        return good;
+    }
+
+    bool osaJSON1394ConfigureActuator(const Json::Value & jsonActuator,
+                                      const std::string & context,
+                                      const bool onlyIO,
+                                      osaActuator1394Configuration & actuator)
+    {
+        bool good = true;
+
+        good &= osaJSON1394GetValue(jsonActuator, context, "BoardID", actuator.BoardID);
+        if ((actuator.BoardID < 0) || (actuator.BoardID >= static_cast<int>(MAX_BOARDS))) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394ConfigureActuator: " << context << " invalid board number "
+                               << actuator.BoardID << std::endl;
+            return false;
+        }
+        good &= osaJSON1394GetValue(jsonActuator, context, "AxisID", actuator.AxisID);
+        if ((actuator.AxisID < 0) || (actuator.AxisID >= static_cast<int>(MAX_AXES))) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394ConfigureActuator: " << context << " invalid axis number "
+                               << actuator.AxisID << std::endl;
+            return false;
+        }
+        good &= osaJSON1394GetValue(jsonActuator, context, "JointType", actuator.JointType);
+        good &= osaJSON1394GetValue(jsonActuator, context, "Drive", actuator.Drive);
+        good &= osaJSON1394GetValue(jsonActuator, context, "Encoder", actuator.Encoder, !onlyIO);
+        good &= osaJSON1394GetValue(jsonActuator, context, "Pot", actuator.Pot, false);
+
+        // brake is optional, stored as a pointer so it can't be
+        // deserialized with the actuator
+        actuator.Brake = nullptr;
+        const Json::Value & jsonBrake = jsonActuator["Brake"];
+        if (jsonBrake.isObject()) {
+            actuator.Brake = new osaAnalogBrake1394Configuration;
+            try {
+                cmnDataJSON<osaAnalogBrake1394Configuration>::DeSerializeText(*(actuator.Brake), jsonBrake);
+            } catch (std::exception & e) {
+                CMN_LOG_INIT_ERROR << "osaJSON1394ConfigureActuator: " << context
+                                   << " failed to parse Brake: " << e.what() << std::endl;
+                good = false;
+            }
+        }
+        return good;
+    }
+
+    bool osaJSON1394ConfigureReflex(const Json::Value & jsonReflex,
+                                    const std::string & context,
+                                    osaReflex1394Configuration & reflex)
+    {
+        bool good = true;
+        good &= osaJSON1394GetValue(jsonReflex, context, "Input", reflex.Input);
+        good &= osaJSON1394GetValue(jsonReflex, context, "WhenPressed", reflex.WhenPressed, false);
+        good &= osaJSON1394GetValue(jsonReflex, context, "Output", reflex.Output, false);
+        good &= osaJSON1394GetValue(jsonReflex, context, "OutputValue", reflex.OutputValue, false);
+        good &= osaJSON1394GetValue(jsonReflex, context, "PowerOff", reflex.PowerOff, false);
+        return good;
+    }
+
+    bool osaJSON1394ConfigureAnalogInput(const Json::Value & jsonAnalogInput,
+                                         const std::string & context,
+                                         osaAnalogInput1394Configuration & analogInput)
+    {
+        bool good = true;
+        good &= osaJSON1394GetValue(jsonAnalogInput, context, "Name", analogInput.Name);
+        good &= osaJSON1394GetValue(jsonAnalogInput, context, "BoardID", analogInput.BoardID);
+        good &= osaJSON1394GetValue(jsonAnalogInput, context, "AxisID", analogInput.AxisID);
+        const Json::Value & jsonBitsToValue = jsonAnalogInput["BitsToValue"];
+        const std::string bitsToValueContext = context + ".BitsToValue";
+        good &= osaJSON1394GetValue(jsonBitsToValue, bitsToValueContext, "Scale", analogInput.BitsToValue.Scale, false);
+        good &= osaJSON1394GetValue(jsonBitsToValue, bitsToValueContext, "Offset", analogInput.BitsToValue.Offset, false);
+        good &= osaJSON1394GetValue(jsonAnalogInput, context, "FIR", analogInput.FIR, false);
+        good &= osaJSON1394GetValue(jsonAnalogInput, context, "IIR", analogInput.IIR, false);
+        good &= osaJSON1394GetValue(jsonAnalogInput, context, "Decimation", analogInput.Decimation, false);
+        good &= osaJSON1394GetValue(jsonAnalogInput, context, "Window", analogInput.Window, false);
+        return good;
+    }
+
+} // namespace sawRobotIO1394
@@ -0,0 +1,138 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+
+#include <sawRobotIO1394/osaPotCoupling1394.h>
+
+using namespace sawRobotIO1394;
+
+void osaPotCoupling1394::Configure(const vctDoubleMat & coupling,
+                                   const double tolerance)
+{
+    mDense.SetSize(0, 0);
+    mRowStart.clear();
+    mColumns.clear();
+    mValues.clear();
+
+    if (coupling.size() == 0) {
+        mKernel = NONE;
+        return;
+    }
+
+    // build CSR representation, used to detect structure
+    const size_t rows = coupling.rows();
+    const size_t cols = coupling.cols();
+    bool identity = (rows == cols);
+    bool permutation = (rows == cols);
+    std::vector<bool> columnUsed(cols, false);
+    mRowStart.reserve(rows + 1);
+    for (size_t row = 0; row < rows; ++row) {
+        mRowStart.push_back(mValues.size());
+        size_t nonZerosInRow = 0;
+        for (size_t col = 0; col < cols; ++col) {
+            const double value = coupling.Element(row, col);
+            if (std::abs(value) > tolerance) {
+                mColumns.push_back(col);
+                mValues.push_back(value);
+                ++nonZerosInRow;
+                if ((value != 1.0) || (row != col)) {
+                    identity = false;
+                }
+                if (value != 1.0) {
+                    permutation = false;
+                } else if (columnUsed[col]) {
+                    permutation = false;
+                } else {
+                    columnUsed[col] = true;
+                }
+            }
+        }
+        if (nonZerosInRow != 1) {
+            identity = false;
+            permutation = false;
+        }
+    }
+    mRowStart.push_back(mValues.size());
+
+    if (identity) {
+        mKernel = IDENTITY;
+    } else if (permutation) {
+        mKernel = PERMUTATION;
+    } else if (2 * mValues.size() <= rows * cols) {
+        mKernel = SPARSE;
+    } else {
+        mKernel = DENSE;
+        mDense.ForceAssign(coupling);
+    }
+}
+
+void osaPotCoupling1394::Apply(const vctDoubleVec & input,
+                               vctDoubleVec & output) const
+{
+    switch (mKernel) {
+    case NONE:
+    case IDENTITY:
+        output.Assign(input);
+        break;
+    case PERMUTATION:
+        {
+            auto column = mColumns.cbegin();
+            const auto end = output.end();
+            for (auto out = output.begin();
+                 out != end;
+                 ++out,
+                     ++column) {
+                *out = input.Element(*column);
+            }
+        }
+        break;
+    case SPARSE:
+        {
+            const size_t rows = output.size();
+            for (size_t row = 0; row < rows; ++row) {
+                double sum = 0.0;
+                const size_t last = mRowStart[row + 1];
+                for (size_t index = mRowStart[row]; index < last; ++index) {
+                    sum += mValues[index] * input.Element(mColumns[index]);
+                }
+                output.Element(row) = sum;
+            }
+        }
+        break;
+    case DENSE:
+        output.ProductOf(mDense, input);
+        break;
+    }
+}
+
+std::string osaPotCoupling1394::KernelToString(const KernelType kernel)
+{
+    switch (kernel) {
+    case NONE:
+        return "none";
+    case IDENTITY:
+        return "identity";
+    case PERMUTATION:
+        return "permutation";
+    case SPARSE:
+        return "sparse";
+    case DENSE:
+        return "dense";
+    }
+    return "undefined";
+}
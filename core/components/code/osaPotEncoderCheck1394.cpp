@@ -0,0 +1,190 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include <sawRobotIO1394/osaPotEncoderCheck1394.h>
+
+using namespace sawRobotIO1394;
+
+void osaPotEncoderCheck1394::Configure(const std::vector<osaPotTolerance1394Configuration> & tolerances)
+{
+    mNumberOfActuators = tolerances.size();
+    mDistance.SetSize(mNumberOfActuators);
+    mLatency.SetSize(mNumberOfActuators);
+    mRecovery.SetSize(mNumberOfActuators);
+    mError.SetSize(mNumberOfActuators);
+    mErrorDuration.SetSize(mNumberOfActuators);
+    mValid.SetSize(mNumberOfActuators);
+    mNewlyInvalid.SetSize(mNumberOfActuators);
+    mWindowSum.SetSize(mNumberOfActuators);
+    mWindowNextSum.SetSize(mNumberOfActuators);
+    mWindowSize.resize(mNumberOfActuators);
+    mWindowStart.resize(mNumberOfActuators);
+    mWindowHead.resize(mNumberOfActuators);
+    mWindowCount.resize(mNumberOfActuators);
+
+    size_t bufferSize = 0;
+    for (size_t index = 0; index < mNumberOfActuators; ++index) {
+        const osaPotTolerance1394Configuration & tolerance = tolerances[index];
+        SetTolerance(index, tolerance);
+        mWindowSize[index] = WindowSize(tolerance);
+        mWindowStart[index] = bufferSize;
+        bufferSize += mWindowSize[index];
+    }
+    mWindowBuffer.resize(bufferSize);
+    Reset();
+}
+
+bool osaPotEncoderCheck1394::UpdateTolerances(const std::vector<osaPotTolerance1394Configuration> & tolerances)
+{
+    if (tolerances.size() != mNumberOfActuators) {
+        return false;
+    }
+    for (size_t index = 0; index < mNumberOfActuators; ++index) {
+        if (WindowSize(tolerances[index]) != mWindowSize[index]) {
+            return false;
+        }
+    }
+    for (size_t index = 0; index < mNumberOfActuators; ++index) {
+        SetTolerance(index, tolerances[index]);
+    }
+    return true;
+}
+
+void osaPotEncoderCheck1394::SetTolerance(const size_t index,
+                                          const osaPotTolerance1394Configuration & tolerance)
+{
+    mDistance[index] = tolerance.Distance;
+    mLatency[index] = tolerance.Latency;
+    // hysteresis can't be larger than distance
+    double hysteresis = tolerance.Hysteresis;
+    if (hysteresis < 0.0) {
+        hysteresis = 0.0;
+    } else if (hysteresis > tolerance.Distance) {
+        hysteresis = tolerance.Distance;
+    }
+    mRecovery[index] = tolerance.Distance - hysteresis;
+}
+
+size_t osaPotEncoderCheck1394::WindowSize(const osaPotTolerance1394Configuration & tolerance)
+{
+    return (tolerance.WindowSamples > 1) ? tolerance.WindowSamples : 1;
+}
+
+void osaPotEncoderCheck1394::Reset(void)
+{
+    mError.SetAll(0.0);
+    mErrorDuration.SetAll(0.0);
+    mValid.SetAll(true);
+    mNewlyInvalid.SetAll(false);
+    mNumberOfInvalid = 0;
+    mWindowSum.SetAll(0.0);
+    mWindowNextSum.SetAll(0.0);
+    std::fill(mWindowHead.begin(), mWindowHead.end(), 0);
+    std::fill(mWindowCount.begin(), mWindowCount.end(), 0);
+    std::fill(mWindowBuffer.begin(), mWindowBuffer.end(), 0.0);
+}
+
+bool osaPotEncoderCheck1394::Check(const vctDoubleVec & pots,
+                                   const vctDoubleVec & encoders,
+                                   const vctDoubleVec & elapsed)
+{
+    bool statusChanged = false;
+    for (size_t index = 0; index < mNumberOfActuators; ++index) {
+        mNewlyInvalid[index] = false;
+        // if tolerance set to 0, disable check for that actuator.  The
+        // tolerance can be set to 0 at runtime (see UpdateTolerances)
+        // so clear any previous state
+        if (mDistance[index] == 0.0) {
+            if (!mValid[index]) {
+                mValid[index] = true;
+                --mNumberOfInvalid;
+                statusChanged = true;
+            }
+            mError[index] = 0.0;
+            mErrorDuration[index] = 0.0;
+            if (mWindowCount[index] != 0) {
+                std::fill(mWindowBuffer.begin() + mWindowStart[index],
+                          mWindowBuffer.begin() + mWindowStart[index] + mWindowSize[index],
+                          0.0);
+                mWindowSum[index] = 0.0;
+                mWindowNextSum[index] = 0.0;
+                mWindowHead[index] = 0;
+                mWindowCount[index] = 0;
+            }
+            continue;
+        }
+
+        // average error over window
+        const double delta = pots[index] - encoders[index];
+        const size_t windowSize = mWindowSize[index];
+        if (windowSize == 1) {
+            mError[index] = delta;
+        } else {
+            double * window = &(mWindowBuffer[mWindowStart[index]]);
+            size_t & head = mWindowHead[index];
+            size_t & count = mWindowCount[index];
+            // running sum, constant time per cycle
+            mWindowSum[index] += delta - window[head];
+            mWindowNextSum[index] += delta;
+            window[head] = delta;
+            ++head;
+            if (head == windowSize) {
+                // the window now only contains the samples added since
+                // last wrap, restart from their sum to drop rounding errors
+                head = 0;
+                mWindowSum[index] = mWindowNextSum[index];
+                mWindowNextSum[index] = 0.0;
+            }
+            mError[index] = mWindowSum[index] / windowSize;
+            // wait for a full window before checking
+            if (count < windowSize) {
+                ++count;
+                if (count < windowSize) {
+                    continue;
+                }
+            }
+        }
+
+        const double error = std::abs(mError[index]);
+        if (mValid[index]) {
+            if (error > mDistance[index]) {
+                mErrorDuration[index] += elapsed[index];
+                // check how long have we been off
+                if (mErrorDuration[index] > mLatency[index]) {
+                    mValid[index] = false;
+                    mNewlyInvalid[index] = true;
+                    ++mNumberOfInvalid;
+                    statusChanged = true;
+                }
+            } else {
+                mErrorDuration[index] = 0.0;
+            }
+        } else {
+            // back to normal only when below distance - hysteresis
+            if (error <= mRecovery[index]) {
+                mErrorDuration[index] = 0.0;
+                mValid[index] = true;
+                --mNumberOfInvalid;
+                statusChanged = true;
+            }
+        }
+    }
+    return statusChanged;
+}
@@ -0,0 +1,380 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+#include <sawRobotIO1394/osaPotLookupTable1394.h>
+#include <sawRobotIO1394/mtsRobot1394.h>
+
+using namespace sawRobotIO1394;
+
+void osaPotLookupTable1394::SetSize(const size_t numberOfActuators,
+                                    const size_t numberOfEntries)
+{
+    mTables.SetSize(numberOfActuators, numberOfEntries);
+    mTables.SetAll(mtsRobot1394::GetMissingPotValue());
+    mLastIndex.assign(numberOfActuators, -1);
+    mWordsPerActuator = (numberOfEntries + 63) / 64;
+    // everything is missing until tables are set
+    mMissingBits.assign(numberOfActuators * mWordsPerActuator, ~static_cast<uint64_t>(0));
+    mMissing.SetSize(numberOfActuators);
+    mMissing.SetAll(false);
+    mAnyMissing = false;
+}
+
+size_t osaPotLookupTable1394::SetTable(const size_t actuator,
+                                       const vctDoubleVec & table,
+                                       const bool interpolateGaps)
+{
+    const size_t size = std::min(table.size(), mTables.cols());
+    double * row = mTables.Pointer(actuator, 0);
+    uint64_t * bits = &(mMissingBits[actuator * mWordsPerActuator]);
+    mLastIndex[actuator] = static_cast<int>(size) - 1;
+
+    int previousValid = -1;
+    for (size_t index = 0; index < size; ++index) {
+        const double value = table[index];
+        row[index] = value;
+        if (mtsRobot1394::IsMissingPotValue(value)) {
+            continue;
+        }
+        // fill gap since previous valid entry
+        if (interpolateGaps
+            && (previousValid >= 0)
+            && (static_cast<size_t>(previousValid) + 1 < index)) {
+            const double start = row[previousValid];
+            const double slope = (value - start) / (index - previousValid);
+            for (size_t gap = previousValid + 1; gap < index; ++gap) {
+                row[gap] = start + slope * (gap - previousValid);
+            }
+        }
+        previousValid = static_cast<int>(index);
+    }
+
+    // build bitmap, entries past the table size stay missing
+    size_t missing = 0;
+    for (size_t index = 0; index < mTables.cols(); ++index) {
+        const uint64_t mask = static_cast<uint64_t>(1) << (index & 63);
+        if ((index < size) && !mtsRobot1394::IsMissingPotValue(row[index])) {
+            bits[index >> 6] &= ~mask;
+        } else {
+            bits[index >> 6] |= mask;
+            if (index < size) {
+                ++missing;
+            }
+        }
+    }
+    return missing;
+}
+
+void osaPotLookupTable1394::Lookup(const vctIntVec & raw,
+                                   vctDoubleVec & positions)
+{
+    mAnyMissing = false;
+    const size_t numberOfActuators = mLastIndex.size();
+    const size_t columns = mTables.cols();
+    const double * table = mTables.Pointer(0, 0);
+    const uint64_t * bits = mMissingBits.data();
+    for (size_t actuator = 0;
+         actuator < numberOfActuators;
+         ++actuator,
+             table += columns,
+             bits += mWordsPerActuator) {
+        int index = raw[actuator];
+        bool missing = false;
+        // clamp to valid range
+        if (index < 0) {
+            index = 0;
+            missing = true;
+        } else if (index > mLastIndex[actuator]) {
+            index = mLastIndex[actuator];
+            missing = true;
+        }
+        if (index < 0) {
+            // empty table
+            positions[actuator] = mtsRobot1394::GetMissingPotValue();
+            missing = true;
+        } else {
+            positions[actuator] = table[index];
+            missing |= ((bits[index >> 6] >> (index & 63)) & 1);
+        }
+        mMissing[actuator] = missing;
+        mAnyMissing |= missing;
+    }
+}
+
+namespace {
+
+    //! Minimal single pass JSON scanner for lookup table files
+    class LookupTableParser {
+    public:
+        LookupTableParser(const std::string & content):
+            mBegin(content.c_str()),
+            mCurrent(content.c_str()),
+            mEnd(content.c_str() + content.size())
+        {}
+
+        bool Parse(std::string & serialNumber,
+                   const std::vector<vctDoubleVec *> & tables,
+                   size_t & rowsFound) {
+            rowsFound = 0;
+            bool lookupFound = false;
+            if (!Expect('{')) {
+                return false;
+            }
+            SkipWhitespace();
+            if (Peek() == '}') {
+                return Error("missing \"lookup\"");
+            }
+            do {
+                std::string key;
+                if (!ParseString(key) || !Expect(':')) {
+                    return false;
+                }
+                if (key == "serial") {
+                    if (!ParseScalar(serialNumber)) {
+                        return false;
+                    }
+                } else if (key == "lookup") {
+                    if (!ParseLookup(tables, rowsFound)) {
+                        return false;
+                    }
+                    lookupFound = true;
+                } else if (!SkipValue()) {
+                    return false;
+                }
+            } while (Next(','));
+            if (!Expect('}')) {
+                return false;
+            }
+            if (!lookupFound) {
+                return Error("missing \"lookup\"");
+            }
+            return true;
+        }
+
+        const std::string & ErrorMessage(void) const {
+            return mErrorMessage;
+        }
+
+    protected:
+        void SkipWhitespace(void) {
+            while ((mCurrent < mEnd)
+                   && ((*mCurrent == ' ') || (*mCurrent == '\n')
+                       || (*mCurrent == '\r') || (*mCurrent == '\t'))) {
+                ++mCurrent;
+            }
+        }
+
+        char Peek(void) const {
+            return (mCurrent < mEnd) ? *mCurrent : '\0';
+        }
+
+        //! Consume character if found after whitespace
+        bool Next(const char character) {
+            SkipWhitespace();
+            if (Peek() == character) {
+                ++mCurrent;
+                return true;
+            }
+            return false;
+        }
+
+        bool Expect(const char character) {
+            if (!Next(character)) {
+                return Error(std::string("expected '") + character + "'");
+            }
+            return true;
+        }
+
+        bool Error(const std::string & message) {
+            const size_t line = std::count(mBegin, mCurrent, '\n') + 1;
+            mErrorMessage = "line " + std::to_string(line) + ": " + message;
+            return false;
+        }
+
+        //! Escaped characters are kept as is, not needed for serial numbers
+        bool ParseString(std::string & value) {
+            if (!Expect('"')) {
+                return false;
+            }
+            const char * start = mCurrent;
+            while ((mCurrent < mEnd) && (*mCurrent != '"')) {
+                if (*mCurrent == '\\') {
+                    ++mCurrent;
+                }
+                ++mCurrent;
+            }
+            if (mCurrent >= mEnd) {
+                return Error("unterminated string");
+            }
+            value.assign(start, mCurrent);
+            ++mCurrent;
+            return true;
+        }
+
+        bool ParseNumber(double & value) {
+            SkipWhitespace();
+            // content is null terminated so strtod stops at the end
+            char * end;
+            value = strtod(mCurrent, &end);
+            if (end == mCurrent) {
+                return Error("expected a number");
+            }
+            mCurrent = end;
+            return true;
+        }
+
+        //! Serial numbers can be saved as strings or numbers
+        bool ParseScalar(std::string & value) {
+            SkipWhitespace();
+            if (Peek() == '"') {
+                return ParseString(value);
+            }
+            const char * start = mCurrent;
+            double number;
+            if (!ParseNumber(number)) {
+                return false;
+            }
+            value.assign(start, mCurrent);
+            return true;
+        }
+
+        bool ParseLookup(const std::vector<vctDoubleVec *> & tables,
+                         size_t & row) {
+            if (!Expect('[')) {
+                return false;
+            }
+            if (Next(']')) {
+                return true;
+            }
+            // reused for all rows
+            std::vector<double> scratch;
+            do {
+                scratch.clear();
+                if (!Expect('[')) {
+                    return false;
+                }
+                if (!Next(']')) {
+                    do {
+                        double value;
+                        if (!ParseNumber(value)) {
+                            return false;
+                        }
+                        scratch.push_back(value);
+                    } while (Next(','));
+                    if (!Expect(']')) {
+                        return false;
+                    }
+                }
+                if (scratch.empty()) {
+                    return Error("empty row " + std::to_string(row));
+                }
+                // extra rows are counted but not stored
+                if (row < tables.size()) {
+                    vctDoubleVec & table = *(tables[row]);
+                    table.SetSize(scratch.size());
+                    std::copy(scratch.begin(), scratch.end(), table.begin());
+                }
+                ++row;
+            } while (Next(','));
+            return Expect(']');
+        }
+
+        //! Skip any value, used for keys we don't need
+        bool SkipValue(void) {
+            SkipWhitespace();
+            const char first = Peek();
+            if (first == '"') {
+                std::string unused;
+                return ParseString(unused);
+            }
+            if ((first == '[') || (first == '{')) {
+                const char last = (first == '[') ? ']' : '}';
+                ++mCurrent;
+                if (Next(last)) {
+                    return true;
+                }
+                do {
+                    if (first == '{') {
+                        std::string key;
+                        if (!ParseString(key) || !Expect(':')) {
+                            return false;
+                        }
+                    }
+                    if (!SkipValue()) {
+                        return false;
+                    }
+                } while (Next(','));
+                return Expect(last);
+            }
+            // number, true, false or null
+            const char * start = mCurrent;
+            while ((mCurrent < mEnd)
+                   && (*mCurrent != ',') && (*mCurrent != ']') && (*mCurrent != '}')
+                   && (*mCurrent != ' ') && (*mCurrent != '\n') && (*mCurrent != '\r') && (*mCurrent != '\t')) {
+                ++mCurrent;
+            }
+            if (mCurrent == start) {
+                return Error("expected a value");
+            }
+            return true;
+        }
+
+        const char * mBegin;
+        const char * mCurrent;
+        const char * mEnd;
+        std::string mErrorMessage;
+    };
+
+} // namespace
+
+bool sawRobotIO1394::osaPotLookupTable1394ReadFile(const std::string & filename,
+                                                   std::string & serialNumber,
+                                                   const std::vector<vctDoubleVec *> & tables,
+                                                   std::string & errorMessage)
+{
+    std::ifstream stream(filename.c_str(), std::ios::binary);
+    if (!stream) {
+        errorMessage = "unable to open file \"" + filename + "\"";
+        return false;
+    }
+    stream.seekg(0, std::ios::end);
+    std::string content;
+    content.resize(static_cast<size_t>(stream.tellg()));
+    stream.seekg(0, std::ios::beg);
+    stream.read(&content[0], content.size());
+    if (!stream) {
+        errorMessage = "failed to read file \"" + filename + "\"";
+        return false;
+    }
+
+    LookupTableParser parser(content);
+    size_t rowsFound;
+    if (!parser.Parse(serialNumber, tables, rowsFound)) {
+        errorMessage = "error found while parsing \"" + filename + "\", " + parser.ErrorMessage();
+        return false;
+    }
+    if (rowsFound != tables.size()) {
+        errorMessage = "size of lookup table in \"" + filename + "\" doesn't match the number of actuators, found "
+            + std::to_string(rowsFound) + " but was expecting " + std::to_string(tables.size());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,94 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnThrow.h>
+
+#include <sawRobotIO1394/osaReflexEngine1394.h>
+#include <sawRobotIO1394/mtsDigitalInput1394.h>
+#include <sawRobotIO1394/mtsDigitalOutput1394.h>
+#include <sawRobotIO1394/mtsRobot1394.h>
+
+namespace sawRobotIO1394 {
+
+    void osaReflexEngine1394::Clear(void)
+    {
+        mRules.clear();
+    }
+
+    void osaReflexEngine1394::Add(const Rule & rule)
+    {
+        if (rule.Input == nullptr) {
+            cmnThrow("osaReflexEngine1394::Add: input pointer is null.");
+        }
+        State state;
+        state.Definition = rule;
+        state.Initialized = false;
+        state.Active = false;
+        state.PowerOffSent = false;
+        mRules.push_back(state);
+    }
+
+    void osaReflexEngine1394::Evaluate(void)
+    {
+        for (size_t index = 0; index < mRules.size(); ++index) {
+            State & state = mRules[index];
+            const Rule & rule = state.Definition;
+            const bool active = (rule.Input->Value() == rule.WhenPressed);
+
+            // outputs held while the rule is active, released once
+            if (!state.Initialized || (active != state.Active)) {
+                state.Initialized = true;
+                state.Active = active;
+                if (rule.Output) {
+                    if (active) {
+                        rule.Output->Hold(rule.OutputValue);
+                    } else {
+                        rule.Output->Release(!rule.OutputValue);
+                    }
+                }
+            }
+
+            // power off as long as the rule is active, including if power is requested later
+            if (rule.Robot
+                && PowerOffRequired(active, rule.Robot->PowerEnable(), state.PowerOffSent)) {
+                rule.Robot->PowerOffSequence(false);
+                // rule index as value, index is used for actuators
+                rule.Robot->Report(osa1394::REFLEX_POWER_OFF, -1, static_cast<double>(index));
+            }
+        }
+    }
+
+    bool osaReflexEngine1394::Active(const size_t index) const
+    {
+        return mRules.at(index).Active;
+    }
+
+    bool osaReflexEngine1394::PowerOffRequired(const bool active, const bool powerEnabled,
+                                               bool & powerOffSent)
+    {
+        if (!active || !powerEnabled) {
+            powerOffSent = false;
+            return false;
+        }
+        if (powerOffSent) {
+            return false;
+        }
+        powerOffSent = true;
+        return true;
+    }
+
+} // namespace sawRobotIO1394
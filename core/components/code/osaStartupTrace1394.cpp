@@ -0,0 +1,126 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <fstream>
+
+#include <cisstOSAbstraction/osaGetTime.h>
+
+#include <sawRobotIO1394/osaStartupTrace1394.h>
+
+namespace sawRobotIO1394 {
+
+    namespace {
+
+        void EscapedToStream(std::ostream & output, const std::string & text) {
+            output << '"';
+            for (const char character : text) {
+                switch (character) {
+                case '"':
+                    output << "\\\"";
+                    break;
+                case '\\':
+                    output << "\\\\";
+                    break;
+                case '\n':
+                    output << "\\n";
+                    break;
+                default:
+                    output << character;
+                }
+            }
+            output << '"';
+        }
+
+    } // namespace
+
+    osaStartupTrace1394::osaStartupTrace1394(void):
+        mOrigin(osaGetTime())
+    {
+    }
+
+    void osaStartupTrace1394::SetFilename(const std::string & filename)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mFilename = filename;
+    }
+
+    void osaStartupTrace1394::Add(const std::string & name, const char * category,
+                                  const double startTime, const double endTime)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const auto thread = mThreadIndices.emplace(std::this_thread::get_id(),
+                                                   mThreadIndices.size());
+        mEvents.push_back({name, category,
+                           startTime - mOrigin, endTime - startTime,
+                           thread.first->second});
+    }
+
+    bool osaStartupTrace1394::Save(void) const
+    {
+        std::ofstream file(mFilename);
+        if (!file.is_open()) {
+            return false;
+        }
+        ToStream(file);
+        return file.good();
+    }
+
+    void osaStartupTrace1394::ToStream(std::ostream & output) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // times are in micro seconds
+        output << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+        for (size_t index = 0; index < mEvents.size(); ++index) {
+            const Event & event = mEvents.at(index);
+            output << ((index == 0) ? "\n  " : ",\n  ")
+                   << "{\"name\": ";
+            EscapedToStream(output, event.Name);
+            output << ", \"cat\": \"" << event.Category << "\""
+                   << ", \"ph\": \"X\""
+                   << ", \"ts\": " << static_cast<long long>(event.StartTime * 1.0e6)
+                   << ", \"dur\": " << static_cast<long long>(event.Duration * 1.0e6)
+                   << ", \"pid\": 1, \"tid\": " << event.ThreadIndex << "}";
+        }
+        output << "\n]}" << std::endl;
+    }
+
+    osaStartupTrace1394::Scope::Scope(osaStartupTrace1394 & trace, const std::string & name,
+                                      const char * category):
+        mTrace(trace.Enabled() ? &trace : nullptr),
+        mCategory(category),
+        mStartTime(0.0)
+    {
+        if (mTrace) {
+            mName = name;
+            mStartTime = osaGetTime();
+        }
+    }
+
+    osaStartupTrace1394::Scope::~Scope()
+    {
+        End();
+    }
+
+    void osaStartupTrace1394::Scope::End(void)
+    {
+        if (mTrace) {
+            mTrace->Add(mName, mCategory, mStartTime, osaGetTime());
+            mTrace = nullptr;
+        }
+    }
+
+} // namespace sawRobotIO1394
@@ -17,7 +17,10 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 
+#include <sstream>
+
 #include <sawRobotIO1394/osaXML1394.h>
+#include <sawRobotIO1394/osaPotLookupTable1394.h>
 #include <cisstCommon/cmnUnits.h>
 #include <cisstCommon/cmnPath.h>
 
@@ -46,6 +49,17 @@ namespace sawRobotIO1394 {
                                  osaPort1394Configuration & config,
                                  const bool & calibrationMode)
     {
+        if (!osaXML1394LoadPort(filename, config, calibrationMode, false)) {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    bool osaXML1394LoadPort(const std::string & filename,
+                            osaPort1394Configuration & config,
+                            const bool & calibrationMode,
+                            const bool & tolerant)
+    {
+        bool good = true;
         cmnXMLPath xmlConfig;
         xmlConfig.SetInputSource(filename);
 
@@ -62,8 +76,7 @@ namespace sawRobotIO1394 {
             CMN_LOG_INIT_ERROR << "Configure: Config/Version is missing in file: "
                                << filename << std::endl
                                << "Make sure you generate your XML files with the latest config generator." << std::endl;
-            exit(EXIT_FAILURE);
-            return;
+            return false;
         } else {
             const int minimumVersion = 5; // backward compatibility
             if (version < minimumVersion) {
@@ -71,8 +84,7 @@ namespace sawRobotIO1394 {
                                    << ", version found is " << version << std::endl
                                    << "File: " << filename << std::endl
                                    << "Make sure you generate your XML files with the latest config generator." << std::endl;
-                exit(EXIT_FAILURE);
-                return;
+                return false;
             }
             const int currentVersion = 5;
             if (version > currentVersion) {
@@ -90,14 +102,17 @@ namespace sawRobotIO1394 {
         for (int i = 0; i < numRobots; i++) {
             osaRobot1394Configuration robot;
 
-            // Store the robot in the config if it's succesfully parsed
-            if (osaXML1394ConfigureRobot(xmlConfig, i + 1, robot, configPath, calibrationMode)) {
-                config.Robots.push_back(robot);
-            } else {
+            // Store the robot in the config if it's succesfully parsed,
+            // in tolerant mode keep it anyway so it can be validated
+            if (!osaXML1394ConfigureRobot(xmlConfig, i + 1, robot, configPath, calibrationMode)) {
                 CMN_LOG_INIT_WARNING << "ConfigurePort: failed to configure robot from file \""
                                      << filename << "\"" << std::endl;
-                exit(EXIT_FAILURE);
+                if (!tolerant) {
+                    return false;
+                }
+                good = false;
             }
+            config.Robots.push_back(robot);
         }
 
         // Get the number of digital input elements
@@ -107,14 +122,17 @@ namespace sawRobotIO1394 {
         for (int i = 0; i < numDigitalInputs; i++) {
             osaDigitalInput1394Configuration digitalInput;
 
-            // Store the digitalInput in the config if it's succesfully parsed
-            if (osaXML1394ConfigureDigitalInput(xmlConfig, i + 1, digitalInput)) {
-                config.DigitalInputs.push_back(digitalInput);
-            } else {
+            // Store the digitalInput in the config if it's succesfully parsed,
+            // in tolerant mode keep it anyway so it can be validated
+            if (!osaXML1394ConfigureDigitalInput(xmlConfig, i + 1, digitalInput)) {
                 CMN_LOG_INIT_WARNING << "ConfigurePort: failed to configure digital input from file \""
                                      << filename << "\"" << std::endl;
-                exit(EXIT_FAILURE);
+                if (!tolerant) {
+                    return false;
+                }
+                good = false;
             }
+            config.DigitalInputs.push_back(digitalInput);
         }
 
         // Get the number of digital output elements
@@ -124,14 +142,17 @@ namespace sawRobotIO1394 {
         for (int i = 0; i < numDigitalOutputs; i++) {
             osaDigitalOutput1394Configuration digitalOutput;
 
-            // Store the digitalOutput in the config if it's succesfully parsed
-            if (osaXML1394ConfigureDigitalOutput(xmlConfig, i + 1, digitalOutput)) {
-                config.DigitalOutputs.push_back(digitalOutput);
-            } else {
+            // Store the digitalOutput in the config if it's succesfully parsed,
+            // in tolerant mode keep it anyway so it can be validated
+            if (!osaXML1394ConfigureDigitalOutput(xmlConfig, i + 1, digitalOutput)) {
                 CMN_LOG_INIT_WARNING << "ConfigurePort: failed to configure digital output from file \""
                                      << filename << "\"" << std::endl;
-                exit(EXIT_FAILURE);
+                if (!tolerant) {
+                    return false;
+                }
+                good = false;
             }
+            config.DigitalOutputs.push_back(digitalOutput);
         }
 
         // Get the number of Dallas chip elements
@@ -141,22 +162,66 @@ namespace sawRobotIO1394 {
         for (int i = 0; i < numDallasChips; i++) {
             osaDallasChip1394Configuration dallasChip;
 
-            // Store the dallasChip in the config if it's succesfully parsed
-            if (osaXML1394ConfigureDallasChip(xmlConfig, i + 1, dallasChip)) {
-                config.DallasChips.push_back(dallasChip);
-            } else {
+            // Store the dallasChip in the config if it's succesfully parsed,
+            // in tolerant mode keep it anyway so it can be validated
+            if (!osaXML1394ConfigureDallasChip(xmlConfig, i + 1, dallasChip)) {
                 CMN_LOG_INIT_WARNING << "ConfigurePort: failed to configure Dallas chip from file \""
                                      << filename << "\"" << std::endl;
-                exit(EXIT_FAILURE);
+                if (!tolerant) {
+                    return false;
+                }
+                good = false;
+            }
+            config.DallasChips.push_back(dallasChip);
+        }
+
+        // Get the number of reflex rules
+        int numReflexes = 0;
+        xmlConfig.GetXMLValue("", "count(/Config/Reflex)", numReflexes);
+
+        for (int i = 0; i < numReflexes; i++) {
+            osaReflex1394Configuration reflex;
+
+            // Store the reflex in the config if it's succesfully parsed,
+            // in tolerant mode keep it anyway so it can be validated
+            if (!osaXML1394ConfigureReflex(xmlConfig, i + 1, reflex)) {
+                CMN_LOG_INIT_WARNING << "ConfigurePort: failed to configure reflex rule from file \""
+                                     << filename << "\"" << std::endl;
+                if (!tolerant) {
+                    return false;
+                }
+                good = false;
+            }
+            config.Reflexes.push_back(reflex);
+        }
+
+        // Get the number of analog inputs
+        int numAnalogInputs = 0;
+        xmlConfig.GetXMLValue("", "count(/Config/AnalogInput)", numAnalogInputs);
+
+        for (int i = 0; i < numAnalogInputs; i++) {
+            osaAnalogInput1394Configuration analogInput;
+
+            // Store the analog input in the config if it's succesfully parsed,
+            // in tolerant mode keep it anyway so it can be validated
+            if (!osaXML1394ConfigureAnalogInput(xmlConfig, i + 1, analogInput)) {
+                CMN_LOG_INIT_WARNING << "ConfigurePort: failed to configure analog input from file \""
+                                     << filename << "\"" << std::endl;
+                if (!tolerant) {
+                    return false;
+                }
+                good = false;
             }
+            config.AnalogInputs.push_back(analogInput);
         }
 
         // Check to make sure something was found
-        if ((numRobots + numDigitalInputs + numDigitalOutputs + numDallasChips) == 0) {
+        if ((numRobots + numDigitalInputs + numDigitalOutputs + numDallasChips + numAnalogInputs) == 0) {
             CMN_LOG_INIT_ERROR << "osaXML1394ConfigurePort: file " << filename
-                               << " doesn't contain any Config/Robot, Config/DigitalIn, Config/DigitalOut or Config/DallasChip" << std::endl;
-            exit(EXIT_FAILURE);
+                               << " doesn't contain any Config/Robot, Config/DigitalIn, Config/DigitalOut, Config/DallasChip or Config/AnalogInput" << std::endl;
+            return false;
         }
+        return good;
     }
 
     bool osaXML1394ConfigureRobot(cmnXMLPath & xmlConfig,
@@ -236,7 +301,7 @@ namespace sawRobotIO1394 {
             if ((actuator.BoardID < 0) || (actuator.BoardID >= (int)MAX_BOARDS)) {
                 CMN_LOG_INIT_ERROR << "Configure: invalid board number " << actuator.BoardID
                                    << " for board " << i << std::endl;
-                return false;
+                good = false;
             }
 
             sprintf(path, "Robot[%d]/Actuator[%d]/@AxisID", robotIndex, actuatorIndex);
@@ -244,7 +309,7 @@ namespace sawRobotIO1394 {
             if ((actuator.AxisID < 0) || (actuator.AxisID >= (int)MAX_AXES)) {
                 CMN_LOG_INIT_ERROR << "Configure: invalid axis number " << actuator.AxisID
                                    << " for actuator " << i << std::endl;
-                return false;
+                good = false;
             }
 
             std::string actuatorType = "";
@@ -398,10 +463,26 @@ namespace sawRobotIO1394 {
             robot.Actuators.push_back(actuator);
         }
 
+        // optional interpolation for missing entries in lookup table
+        std::string lookupTableInterpolation;
+        sprintf(path, "Robot[%d]/Potentiometers/@LookupTableInterpolation", robotIndex);
+        if (xmlConfig.GetXMLValue(context, path, lookupTableInterpolation)) {
+            if (lookupTableInterpolation == std::string("False")) {
+                robot.PotLookupTableInterpolation = false;
+            } else if (lookupTableInterpolation == std::string("True")) {
+                robot.PotLookupTableInterpolation = true;
+            } else {
+                CMN_LOG_INIT_ERROR << "osaXML1394ConfigureRobot: LookupTableInterpolation must be \"True\" or \"False\", not "
+                                   << lookupTableInterpolation << std::endl;
+                good = false;
+            }
+        } else {
+            robot.PotLookupTableInterpolation = false;
+        }
+
         // if potType is not set, check if a LookupTable is available (digital pots on Si arms)
         if (!calibrationMode) {
             std::string potentiometerLookupTable;
-            vctDoubleMat lookupTable;
             sprintf(path,"Robot[%d]/Potentiometers/@LookupTable", robotIndex);
             if (xmlConfig.GetXMLValue(context, path, potentiometerLookupTable)) {
                 // make sure the filename has the serial number in it
@@ -429,54 +510,33 @@ namespace sawRobotIO1394 {
                                        << robot.Name << " in path " << configPath << std::endl;
                     return false;
                 }
-                try {
-                    std::ifstream jsonStream;
-                    Json::Value jsonValue;
-                    Json::Reader jsonReader;
-
-                    jsonStream.open(filename.c_str());
-                    if (!jsonReader.parse(jsonStream, jsonValue)) {
-                        CMN_LOG_INIT_ERROR << "Error found while parsing \""
-                                           << filename << "\":"
-                                           << jsonReader.getFormattedErrorMessages();
-                        return false;
-                    }
-                    // check the serial number in the file
-                    std::string inFileSerial = jsonValue["serial"].asString();
-                    if (inFileSerial != robot.SerialNumber) {
-                        CMN_LOG_INIT_ERROR << "Serial number found lookup table file ("
-                                           << inFileSerial << ") doesn't match the arm one ("
-                                           << robot.SerialNumber << ")" << std::endl;
-                        return false;
-                    }
-                    cmnDataJSON<vctDoubleMat>::DeSerializeText(lookupTable, jsonValue["lookup"]);
-                    // make sure the table size makes sense
-                    if ((lookupTable.rows() != robot.Actuators.size())
-                        || (lookupTable.cols() == 0)) {
-                        CMN_LOG_INIT_ERROR << "Size of lookup table for " << robot.Name
-                                           << " from " << potentiometerLookupTable
-                                           << " doesn't match the number of actuators, found "
-                                           << lookupTable.rows() << " but was expecting " << robot.Actuators.size()
-                                           << std::endl;
-                        return false;
-                    }
-                    // set actuator type for all actuators
-                    for (size_t index = 0;
-                         index < robot.Actuators.size();
-                         ++index) {
-                        robot.Actuators.at(index).Pot.Type = 2;
-                        robot.Actuators.at(index).Pot.LookupTable = lookupTable.Row(index);
-                    }
-                    // for logs
-                    CMN_LOG_INIT_VERBOSE << "Loaded potentiometer lookup table from file \""
-                                         << filename << "\" for arm " << robot.Name
-                                         << " (" << robot.SerialNumber << ")" << std::endl;
-                } catch (...) {
-                    CMN_LOG_INIT_ERROR << "Error found while parsing \""
-                                       << potentiometerLookupTable << "\", make sure the file is in JSON format."
-                                       << std::endl;
+                // parse directly into each actuator's table, no JSON tree
+                std::vector<vctDoubleVec *> tables;
+                for (auto & actuator : robot.Actuators) {
+                    tables.push_back(&(actuator.Pot.LookupTable));
+                }
+                std::string inFileSerial, errorMessage;
+                if (!osaPotLookupTable1394ReadFile(filename, inFileSerial, tables, errorMessage)) {
+                    CMN_LOG_INIT_ERROR << "Error found while loading potentiometer lookup table for "
+                                       << robot.Name << ": " << errorMessage << std::endl;
+                    return false;
+                }
+                // check the serial number in the file
+                if (inFileSerial != robot.SerialNumber) {
+                    CMN_LOG_INIT_ERROR << "Serial number found lookup table file ("
+                                       << inFileSerial << ") doesn't match the arm one ("
+                                       << robot.SerialNumber << ")" << std::endl;
                     return false;
                 }
+                robot.PotLookupTableFile = filename;
+                // set actuator type for all actuators
+                for (auto & actuator : robot.Actuators) {
+                    actuator.Pot.Type = 2;
+                }
+                // for logs
+                CMN_LOG_INIT_VERBOSE << "Loaded potentiometer lookup table from file \""
+                                     << filename << "\" for arm " << robot.Name
+                                     << " (" << robot.SerialNumber << ")" << std::endl;
             }
         }
 
@@ -506,11 +566,25 @@ namespace sawRobotIO1394 {
                 good &= osaXML1394GetValue(xmlConfig, context, path, pot.Distance);
                 sprintf(path, "Robot[%i]/Potentiometers/Tolerance[%d]/@Latency", robotIndex, xmlPotIndex);
                 good &= osaXML1394GetValue(xmlConfig, context, path, pot.Latency);
+                // optional, hysteresis and averaging window
+                pot.Hysteresis = 0.0;
+                sprintf(path, "Robot[%i]/Potentiometers/Tolerance[%d]/@Hysteresis", robotIndex, xmlPotIndex);
+                good &= osaXML1394GetValue(xmlConfig, context, path, pot.Hysteresis, false);
+                pot.WindowSamples = 1;
+                sprintf(path, "Robot[%i]/Potentiometers/Tolerance[%d]/@WindowSamples", robotIndex, xmlPotIndex);
+                good &= osaXML1394GetValue(xmlConfig, context, path, pot.WindowSamples, false);
+                if (pot.WindowSamples < 1) {
+                    CMN_LOG_INIT_ERROR << "Configure: invalid <Potentiometers><Tolerance WindowSamples=\"\"> must be at least 1 but found "
+                                       << pot.WindowSamples << " for Axis " << axis << " for robot "
+                                       << robotIndex << "(" << robot.Name << ")" << std::endl;
+                    good = false;
+                }
                 // convert to proper units
                 sprintf(path, "Robot[%i]/Potentiometers/Tolerance[%d]/@Unit", robotIndex, xmlPotIndex);
                 good &= osaXML1394GetValue(xmlConfig, context, path, unit);
                 if (osaUnitIsDistance(unit)) {
                     pot.Distance *= osaUnitToSIFactor(unit);
+                    pot.Hysteresis *= osaUnitToSIFactor(unit);
                 } else {
                     CMN_LOG_INIT_ERROR << "Configure: invalid <Potentiometers><Tolerance Unit=\"\"> must be rad, deg, mm, m but found \""
                                        << unit << "\" for Axis " << axis << " for robot "
@@ -686,6 +760,7 @@ namespace sawRobotIO1394 {
         digitalOutput.IsPWM = false;
         digitalOutput.HighDuration = 0.0;
         digitalOutput.LowDuration = 0.0;
+        digitalOutput.TriggerPeriod = 0;
 
         // Check there is digital output entry. Return boolean result for success/fail.
         sprintf(path,"DigitalOut[%i]/@Name", outputIndex);
@@ -712,6 +787,10 @@ namespace sawRobotIO1394 {
         if (tagsFound) {
             digitalOutput.IsPWM = true;
         }
+
+        // look for trigger period, in IO cycles
+        sprintf(path,"DigitalOut[%i]/@TriggerPeriod", outputIndex);
+        xmlConfig.GetXMLValue(context, path, digitalOutput.TriggerPeriod, 0);
         return true;
     }
 
@@ -738,4 +817,83 @@ namespace sawRobotIO1394 {
         return true;
     }
 
+
+    bool osaXML1394ConfigureReflex(cmnXMLPath & xmlConfig,
+                                   const int reflexIndex,
+                                   osaReflex1394Configuration & reflex)
+    {
+        char path[64];
+        const char * context = "Config";
+
+        // input is required, actions are optional
+        sprintf(path,"Reflex[%i]/@Input", reflexIndex);
+        if (!xmlConfig.GetXMLValue(context, path, reflex.Input)) {
+            CMN_LOG_INIT_ERROR << "Configuration for " << path << " failed. Stopping config." << std::endl;
+            return false;
+        }
+        sprintf(path,"Reflex[%i]/@WhenPressed", reflexIndex);
+        xmlConfig.GetXMLValue(context, path, reflex.WhenPressed, true);
+        sprintf(path,"Reflex[%i]/@Output", reflexIndex);
+        xmlConfig.GetXMLValue(context, path, reflex.Output, std::string());
+        sprintf(path,"Reflex[%i]/@OutputValue", reflexIndex);
+        xmlConfig.GetXMLValue(context, path, reflex.OutputValue, true);
+        sprintf(path,"Reflex[%i]/@PowerOff", reflexIndex);
+        xmlConfig.GetXMLValue(context, path, reflex.PowerOff, std::string());
+        return true;
+    }
+
+
+    bool osaXML1394ConfigureAnalogInput(cmnXMLPath & xmlConfig,
+                                        const int analogIndex,
+                                        osaAnalogInput1394Configuration & analogInput)
+    {
+        char path[64];
+        const char * context = "Config";
+        bool tagsFound = true;
+
+        sprintf(path,"AnalogInput[%i]/@Name", analogIndex);
+        tagsFound &= xmlConfig.GetXMLValue(context, path, analogInput.Name);
+        sprintf(path,"AnalogInput[%i]/@BoardID", analogIndex);
+        tagsFound &= xmlConfig.GetXMLValue(context, path, analogInput.BoardID);
+        sprintf(path,"AnalogInput[%i]/@AxisID", analogIndex);
+        tagsFound &= xmlConfig.GetXMLValue(context, path, analogInput.AxisID);
+
+        if (!tagsFound) {
+            CMN_LOG_INIT_ERROR << "Configuration for " << path << " failed. Stopping config." << std::endl;
+            return false;
+        }
+
+        // optional conversion and filter
+        sprintf(path,"AnalogInput[%i]/BitsToValue/@Scale", analogIndex);
+        xmlConfig.GetXMLValue(context, path, analogInput.BitsToValue.Scale, 1.0);
+        sprintf(path,"AnalogInput[%i]/BitsToValue/@Offset", analogIndex);
+        xmlConfig.GetXMLValue(context, path, analogInput.BitsToValue.Offset, 0.0);
+        sprintf(path,"AnalogInput[%i]/@IIR", analogIndex);
+        xmlConfig.GetXMLValue(context, path, analogInput.IIR, 1.0);
+        sprintf(path,"AnalogInput[%i]/@Decimation", analogIndex);
+        xmlConfig.GetXMLValue(context, path, analogInput.Decimation, 1);
+        sprintf(path,"AnalogInput[%i]/@Window", analogIndex);
+        xmlConfig.GetXMLValue(context, path, analogInput.Window, 0);
+
+        std::string fir;
+        sprintf(path,"AnalogInput[%i]/@FIR", analogIndex);
+        if (xmlConfig.GetXMLValue(context, path, fir)) {
+            std::istringstream firStream(fir);
+            std::vector<double> coefficients;
+            double coefficient;
+            while (firStream >> coefficient) {
+                coefficients.push_back(coefficient);
+            }
+            if (!firStream.eof()) {
+                CMN_LOG_INIT_ERROR << "Configuration for " << path << " failed, FIR must be a list of numbers. Stopping config." << std::endl;
+                return false;
+            }
+            analogInput.FIR.SetSize(coefficients.size());
+            for (size_t index = 0; index < coefficients.size(); ++index) {
+                analogInput.FIR.at(index) = coefficients.at(index);
+            }
+        }
+        return true;
+    }
+
 }
@@ -0,0 +1,98 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsAnalogInput1394_h
+#define _mtsAnalogInput1394_h
+
+#include <cisstVector/vctFixedSizeVectorTypes.h>
+#include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/osaAnalogFilter1394.h>
+
+#include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Analog input not used as a potentiometer, e.g. auxiliary
+      sensor.  Bits are read and converted every cycle, the filtered
+      value is updated every Decimation cycles and the statistics
+      (min, max, mean) every Window cycles, see
+      osaAnalogInput1394Configuration and osaAnalogFilter1394. */
+    class CISST_EXPORT mtsAnalogInput1394 {
+    public:
+        /*! Pointer on existing services.  This allows to use the class
+          name and level of detail of another class, e.g. the class that
+          owns this map.  To set the "Owner", use the method SetOwner
+          after the cmnNamedMap is constructed. */
+        const cmnClassServicesBase * OwnerServices;
+
+        /*! Method used to emulate the cmnGenericObject interface used by
+          CMN_LOG_CLASS macros. */
+        //@{
+        inline const cmnClassServicesBase * Services(void) const {
+            return this->OwnerServices;
+        }
+
+        inline cmnLogger::StreamBufType * GetLogMultiplexer(void) const {
+            return cmnLogger::GetMultiplexer();
+        }
+        //@}
+
+        mtsAnalogInput1394(const cmnGenericObject & owner,
+                           const osaAnalogInput1394Configuration & config);
+
+        void SetupStateTable(mtsStateTable & stateTable);
+        void SetupProvidedInterface(mtsInterfaceProvided * interfaceProvided, mtsStateTable & stateTable);
+
+        void Configure(const osaAnalogInput1394Configuration & config);
+        void SetBoard(AmpIO * board);
+
+        /*! Read, convert and filter, board must have been read */
+        void PollState(void);
+
+        /*! Send events for new filtered values and statistics */
+        void CheckState(void);
+
+        const osaAnalogInput1394Configuration & Configuration(void) const;
+        const std::string & Name(void) const;
+        const double & Value(void) const;
+        const double & FilteredValue(void) const;
+
+    protected:
+        AmpIO * mBoard = nullptr;
+        osaAnalogInput1394Configuration mConfiguration;
+        std::string mName;
+        int mAxisID;
+        osaAnalogFilter1394 mFilter;
+
+        // State data
+        int mBits = 0;                // raw ADC value
+        double mValue = 0.0;          // converted, every cycle
+        double mFilteredValue = 0.0;  // filtered, every Decimation cycles
+        vctDouble3 mStatistics;       // min, max, mean of last window
+        bool mFilteredValueUpdated = false;
+        bool mStatisticsUpdated = false;
+
+        mtsFunctionWrite FilteredValueEvent;
+        mtsFunctionWrite StatisticsEvent;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _mtsAnalogInput1394_h
@@ -22,6 +22,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsForwardDeclarations.h>
 #include <cisstParameterTypes/prmEventButton.h>
 #include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
 
 #include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
 
@@ -64,17 +65,31 @@ namespace sawRobotIO1394 {
         void CheckState(void);
 
         void Configure(const osaDallasChip1394Configuration & config);
+        /*! Same as Configure but the name can't change, all other
+          values are copied so no memory is allocated.  Used by the IO
+          thread to apply a reconfiguration. */
+        void Reconfigure(const osaDallasChip1394Configuration & config);
         void SetBoard(AmpIO * board);
+        //! FPGA time used to space status polls
+        void SetBoardSnapshot(const osaBoardSnapshot1394 * snapshot);
 
+        /*! While a read is in progress, poll the chip status at most
+          once per poll period instead of every IO cycle.  Each poll
+          costs at least one extra bus transaction and the chip takes
+          tens of milliseconds to answer. */
         void PollState(void);
+        void SetPollPeriod(const double & period);
 
         const osaDallasChip1394Configuration & Configuration(void) const;
         const std::string & Name(void) const;
         const std::string & ToolType(void) const;
-        void TriggerRead(void);
 
+        /*! Start a tool read, ignored if a read is already in
+          progress.  The read is then advanced by PollState. */
+        void TriggerRead(void);
 
     protected:
+        void Poll(void);
         void TriggerToolTypeEvent(const unsigned int & model,
                                   const unsigned int & version,
                                   const std::string & name);
@@ -85,6 +100,9 @@ namespace sawRobotIO1394 {
         std::string mName;
         mtsStdString mToolType = ToolTypeUndefined;
         bool mWaiting = false;
+        const osaBoardSnapshot1394 * mBoardSnapshot = nullptr;
+        double mPollPeriod = 0.01;   // in seconds
+        double mTimeLastPoll = 0.0;  // FPGA time
     };
 
 } // namespace sawRobotIO1394
@@ -21,6 +21,8 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstParameterTypes/prmEventButton.h>
 #include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+#include <sawRobotIO1394/osaDigitalInputEdge1394.h>
 
 #include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
 
@@ -62,19 +64,46 @@ namespace sawRobotIO1394 {
         void CheckState(void);
 
         void Configure(const osaDigitalInput1394Configuration & config);
-        void SetBoard(AmpIO * board);
+        /*! Same as Configure but the name can't change, all other
+          values are copied so no memory is allocated.  Used by the IO
+          thread to apply a reconfiguration. */
+        void Reconfigure(const osaDigitalInput1394Configuration & config);
+        void SetBoardSnapshot(const osaBoardSnapshot1394 * snapshot); // values read once per cycle for all inputs on the board
+        inline const osaBoardSnapshot1394 * BoardSnapshot(void) const {
+            return mBoardSnapshot;
+        }
 
         void PollState(void);
 
+        /*! Update value and debounce using the board's input word,
+          time elapsed since the last read and FPGA time.  Called by
+          PollState or by osaDigitalInputEngine1394 which only calls it
+          when needed, see Busy. */
+        void PollState(const osaBoardSnapshot1394 & snapshot);
+
+        /*! Mask for this input in the board's digital input word */
+        uint32_t BitMask(void) const;
+
+        /*! Input must be updated next cycle even if the board's input
+          word doesn't change, i.e. first run, debouncing or value
+          changed in the last update. */
+        bool Busy(void) const;
+
         const osaDigitalInput1394Configuration & Configuration(void) const;
 
         const std::string & Name(void) const;
         const bool & Value(void) const;
         const bool & PreviousValue(void) const;
 
+        /*! FPGA times (see osaBoardSnapshot1394::FPGATime) of the last
+          value change, before and after debounce. */
+        const double & EdgeTime(void) const;
+        const double & ConfirmedTime(void) const;
+
     protected:
         mtsFunctionWrite Button;    // The event function for button, will return prmEventButton
-        AmpIO * mBoard = nullptr;   // Board Assignment
+        mtsFunctionWrite ButtonEdge; // Same events with FPGA times, will return osaDigitalInputEdge1394
+        const osaBoardSnapshot1394 * mBoardSnapshot = nullptr; // Board Assignment
         mtsDigitalInput1394Data * mData = nullptr; // Internal data using AmpIO types
         osaDigitalInput1394Configuration mConfiguration;
         std::string mName;
@@ -89,15 +118,22 @@ namespace sawRobotIO1394 {
         bool mFirstRun = true;
         bool mValue;                    // Current read value
         bool mTransitionValue;          // For debouncing
+        double mTransitionTime = 0.0;   // FPGA time when debouncing started
         bool mPreviousValue = false;    // Saved value from the previous read
         double mDebounceCounter = -1.0; // time in seconds with constant value
+        double mEdgeTime = 0.0;         // FPGA time of the first read with the new value
+        double mConfirmedTime = 0.0;    // FPGA time when the new value was confirmed by debounce
         mtsStateTable * mStateTable = nullptr;
 
         struct {
             prmEventButton Pressed;
             prmEventButton Released;
             prmEventButton Clicked;
+            osaDigitalInputEdge1394 Edge;
         } mEventPayloads;
+
+        void SendEdge(const osaDigitalInputEdge1394::EdgeType type,
+                      const double edgeTime, const double confirmedTime);
     };
 
 } // namespace sawRobotIO1394
@@ -21,6 +21,9 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstParameterTypes/prmEventButton.h>
 #include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+#include <sawRobotIO1394/osaDigitalOutputBatch1394.h>
+#include <sawRobotIO1394/osaDigitalOutputSequencer1394.h>
 
 #include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
 
@@ -62,7 +65,16 @@ namespace sawRobotIO1394 {
         void CheckState(void);
 
         void Configure(const osaDigitalOutput1394Configuration & config);
+        /*! Same as Configure but the name can't change, all other
+          values are copied so no memory is allocated.  Used by the IO
+          thread to apply a reconfiguration. */
+        void Reconfigure(const osaDigitalOutput1394Configuration & config);
         void SetBoard(AmpIO * board);
+        /*! Changes requested by SetValue are accumulated in the
+          board's batch and written by mtsRobotIO1394::Write. */
+        void SetBatch(osaDigitalOutputBatch1394 * batch);
+        //! Time between reads used to play sequences
+        void SetBoardSnapshot(const osaBoardSnapshot1394 * snapshot);
 
         void PollState(void);
 
@@ -72,10 +84,58 @@ namespace sawRobotIO1394 {
         void SetValue(const bool & newValue);
         void SetPWMDutyCycle(const double & dutyCycle);
 
+        /*! Play a timed sequence of values or duty cycles from the IO
+          thread, see osaDigitalOutputSequencer1394.  SetValue and
+          SetPWMDutyCycle stop the current sequence. */
+        void PlaySequence(const osaDigitalOutputSequence1394 & sequence);
+        void StopSequence(void);
+
+        /*! Called by mtsRobotIO1394 once per cycle before the outputs
+          are written, does nothing if no sequence is playing. */
+        void StepSequence(void);
+
+        /*! Toggle the output every TriggerPeriod cycles (see
+          osaDigitalOutput1394Configuration) and record the FPGA time
+          of the board read preceding the write.  Called by
+          mtsRobotIO1394 once per cycle before the outputs are
+          written. */
+        void StepTrigger(void);
+
+        /*! Used by osaReflexEngine1394.  While held, the value is
+          requested again every cycle after commands, sequences and
+          triggers (see StepHold) so clients can't override it.
+          Unlike SetValue, Hold and Release don't stop the current
+          sequence, it takes over again once the output is
+          released. */
+        //@{
+        void Hold(const bool value);
+        //! Stop holding and request the value once
+        void Release(const bool value);
+        inline bool Held(void) const {
+            return mHeld;
+        }
+        //! Called by mtsRobotIO1394 once per cycle, last before the outputs are written
+        void StepHold(void);
+        //@}
 
     protected:
         mtsFunctionWrite Button;    // The event function for button, will return prmEventButton
         AmpIO * mBoard;              // Board Assignment
+        osaDigitalOutputBatch1394 * mBatch = nullptr; // Changes for this board, shared with other outputs
+        const osaBoardSnapshot1394 * mBoardSnapshot = nullptr;
+        osaDigitalOutputSequencer1394 mSequencer;
+        mtsInterfaceProvided * mInterface = nullptr;
+        // external trigger
+        int mTriggerPeriod = 0;
+        int mTriggerCycles = 0;
+        bool mTriggerValue = false;
+        int mTriggerCount = 0;       // number of toggles since configured
+        double mTriggerTime = 0.0;   // FPGA time of the read preceding the last toggle
+        // reflex
+        bool mHeld = false;
+        bool mHeldValue = false;
+        void WriteValue(const double value); // value or duty cycle for PWM outputs
+        void WritePWMDutyCycle(const double dutyCycle);
         mtsDigitalOutput1394Data * mData; // Internal data using AmpIO types
         osaDigitalOutput1394Configuration mConfiguration;
         std::string mName;
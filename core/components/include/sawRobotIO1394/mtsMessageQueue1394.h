@@ -0,0 +1,195 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsMessageQueue1394_h
+#define _mtsMessageQueue1394_h
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstMultiTask/mtsForwardDeclarations.h>
+
+#include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Fault and status reporting for the IO thread.  The IO thread
+      pushes fixed size messages (fault type and numeric payload) in a
+      preallocated single producer/single consumer ring, without any
+      allocation or formatting.  A low priority thread pops the
+      messages, applies a per source and per fault type rate limit,
+      formats the text and logs it.  Messages meant for the user are
+      then handed back to the IO thread through a second ring and sent
+      with mtsInterfaceProvided::SendError/SendWarning/SendStatus in
+      Dispatch since cisstMultiTask events can only be triggered from
+      the component's thread. */
+    class CISST_EXPORT mtsMessageQueue1394 {
+    public:
+        /*! Pointer on existing services.  This allows to use the class
+          name and level of detail of another class, e.g. the class that
+          owns this map.  To set the "Owner", use the method SetOwner
+          after the cmnNamedMap is constructed. */
+        const cmnClassServicesBase * OwnerServices;
+
+        /*! Method used to emulate the cmnGenericObject interface used by
+          CMN_LOG_CLASS macros. */
+        //@{
+        inline const cmnClassServicesBase * Services(void) const {
+            return this->OwnerServices;
+        }
+
+        inline cmnLogger::StreamBufType * GetLogMultiplexer(void) const {
+            return cmnLogger::GetMultiplexer();
+        }
+        //@}
+
+        //! Severity of each fault type, MESSAGE_LOG is not sent to the user
+        typedef enum {MESSAGE_LOG, MESSAGE_STATUS, MESSAGE_WARNING, MESSAGE_ERROR} SeverityType;
+
+        //! Plain data pushed by the IO thread, meaning of Index and Values depends on Type
+        struct Message {
+            osa1394::FaultType Type;
+            size_t Source;
+            int Index;
+            double Values[3];
+            double Timestamp;
+        };
+
+        mtsMessageQueue1394(const cmnGenericObject & owner,
+                            const size_t capacity = 256);
+        ~mtsMessageQueue1394();
+
+        /*! Register a source of messages, i.e. robot.  The interface
+          provided can be null, messages are then only logged.  Must be
+          called before Start. */
+        size_t AddSource(const std::string & name,
+                         mtsInterfaceProvided * interfaceProvided);
+
+        /*! Minimum time between two messages of the same type for a
+          given source, extra messages are counted and reported
+          later. */
+        void SetMinimumInterval(const double & interval);
+
+        void Start(void);
+        void Stop(void);
+
+        /*! Methods called by the IO thread.  Push returns false if the
+          ring is full, the message is then dropped and counted. */
+        //@{
+        bool Push(const osa1394::FaultType type,
+                  const size_t source,
+                  const double timestamp,
+                  const int index = -1,
+                  const double value0 = 0.0,
+                  const double value1 = 0.0,
+                  const double value2 = 0.0);
+        void Dispatch(const size_t maximumNumberOfMessages = 8);
+        //@}
+
+        size_t NumberOfDroppedMessages(void) const;
+
+        static SeverityType Severity(const osa1394::FaultType type);
+        static void Format(const Message & message,
+                           const std::string & sourceName,
+                           std::string & text);
+
+    protected:
+        /*! Lock free ring for a single producer and single consumer.
+          Elements are preallocated and accessed in place so strings
+          can keep their capacity. */
+        template <class _elementType>
+        class Ring {
+        public:
+            void SetCapacity(const size_t capacity) {
+                size_t size = 1;
+                while (size < capacity) {
+                    size <<= 1;
+                }
+                mElements.resize(size);
+                mMask = size - 1;
+            }
+            //! Producer side, returns nullptr if full
+            _elementType * Back(void) {
+                const size_t head = mHead.load(std::memory_order_relaxed);
+                if ((head - mTail.load(std::memory_order_acquire)) > mMask) {
+                    return nullptr;
+                }
+                return &(mElements[head & mMask]);
+            }
+            void PushBack(void) {
+                mHead.store(mHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+            //! Consumer side, returns nullptr if empty
+            _elementType * Front(void) {
+                const size_t tail = mTail.load(std::memory_order_relaxed);
+                if (tail == mHead.load(std::memory_order_acquire)) {
+                    return nullptr;
+                }
+                return &(mElements[tail & mMask]);
+            }
+            void PopFront(void) {
+                mTail.store(mTail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+            std::vector<_elementType> mElements;
+        protected:
+            size_t mMask = 0;
+            std::atomic<size_t> mHead {0};
+            std::atomic<size_t> mTail {0};
+        };
+
+        struct Outgoing {
+            size_t Source;
+            SeverityType Severity;
+            std::string Text;
+        };
+
+        struct Source {
+            std::string Name;
+            mtsInterfaceProvided * Interface;
+        };
+
+        void * Run(void * argument);
+        void Process(const Message & message, const double now);
+        void ReportSuppressed(const double now, const bool all);
+        void Forward(const size_t source, const SeverityType severity, const std::string & text);
+
+        Ring<Message> mMessages;
+        Ring<Outgoing> mOutgoing;
+        std::vector<Source> mSources;
+
+        //! Rate limiting, indexed by source * osa1394::NUMBER_OF_FAULT_TYPES + type
+        std::vector<double> mTimeLastMessage;
+        std::vector<size_t> mSuppressed;
+        double mMinimumInterval = 1.0 * cmn_s;
+
+        std::atomic<size_t> mDropped {0};
+        size_t mDroppedReported = 0;
+        std::atomic<bool> mRunning {false};
+        osaThread mThread;
+        std::string mText;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _mtsMessageQueue1394_h
@@ -19,6 +19,8 @@ http://www.cisst.org/cisst/license.txt.
 #ifndef _mtsRobot1394_h
 #define _mtsRobot1394_h
 
+#include <atomic>
+
 #include <cisstParameterTypes/prmMaskedVector.h>
 #include <cisstParameterTypes/prmInputData.h>
 #include <cisstParameterTypes/prmConfigurationJoint.h>
@@ -26,6 +28,11 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstParameterTypes/prmForceTorqueJointSet.h>
 
 #include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+#include <sawRobotIO1394/osaFault1394.h>
+#include <sawRobotIO1394/osaPotCoupling1394.h>
+#include <sawRobotIO1394/osaPotEncoderCheck1394.h>
+#include <sawRobotIO1394/osaPotLookupTable1394.h>
 #include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
 
 // Always include last
@@ -64,6 +71,7 @@ namespace sawRobotIO1394 {
                               mtsStateTable * & stateTableRead,
                               mtsStateTable * & stateTableWrite);
         void SetupInterfaces(mtsInterfaceProvided * robotInterface);
+        void SetMessageQueue(mtsMessageQueue1394 * messageQueue);
         void Startup(void);
         void StartReadStateTable(void);
         void AdvanceReadStateTable(void);
@@ -71,6 +79,27 @@ namespace sawRobotIO1394 {
         void AdvanceWriteStateTable(void);
         bool CheckConfiguration(void);
 
+        /*! \name Calibration reload
+          CheckCalibration validates a new configuration against the
+          current layout (actuators, boards, axes, pot and brake types
+          and pot check window sizes) and, unless
+          skipConfigurationCheck is set, runs the same checks as
+          Configure (units vs joint types and CheckConfiguration) on
+          the new values.  StageCalibration computes the
+          new scales, offsets, limits and pot tolerances.  Both must be
+          called from a thread other than the IO thread as they
+          allocate memory.  Staged values are applied by
+          ApplyStagedCalibration, called by the IO thread between two
+          cycles, which only copies values.  The stored configuration
+          (GetConfiguration) is not updated. */
+        //@{
+        bool CheckCalibration(const osaRobot1394Configuration & config,
+                              const bool skipConfigurationCheck,
+                              std::string & errorMessage) const;
+        bool StageCalibration(const osaRobot1394Configuration & config);
+        void ApplyStagedCalibration(void);
+        //@}
+
         // Wrapper of osa methods to match command signatures
         void GetNumberOfActuators(size_t & num_actuators) const;
         void GetSerialNumber(std::string & serialNumber) const;
@@ -88,6 +117,16 @@ namespace sawRobotIO1394 {
         void SetBoards(const std::vector<osaActuatorMapping> & actuatorBoards,
                        const std::vector<osaBrakeMapping> & brakeBoards);
 
+        /*! Per board values extracted once per cycle by
+          mtsRobotIO1394, indexed by board ID.  Must be called after
+          SetBoards and before PollValidity. */
+        void SetBoardSnapshots(const osaBoardSnapshot1394 * snapshots);
+
+        /*! Check hardware and firmware versions using board information
+          queried once by mtsRobotIO1394 for all boards (boards can be
+          shared between robots).  Must be called after SetBoards. */
+        void CheckBoards(const std::map<int, osaBoardInfo1394> & boardInfo);
+
         void GetFirmwareRange(unsigned int & lowest, unsigned int & highest) const;
         /**}**/
 
@@ -101,6 +140,17 @@ namespace sawRobotIO1394 {
         void CheckState(void);
         /**}**/
 
+        /*! Report a fault or status change.  This doesn't allocate
+          memory and can be called from the IO thread, messages are
+          formatted, rate limited and sent by the message queue.
+          Anything worth sending to the user is also published as a
+          structured osaFault1394 using the event "Fault". */
+        void Report(const osa1394::FaultType type,
+                    const int index = -1,
+                    const double value0 = 0.0,
+                    const double value1 = 0.0,
+                    const double value2 = 0.0);
+
         /** \name Command Functions
          * These functions interact with the lower-level hardware when called to
          * change its state in some way. Note that these functions do not have
@@ -271,7 +321,10 @@ namespace sawRobotIO1394 {
         //! Board Objects
         std::vector<osaActuatorMapping> mActuatorInfo;
         std::vector<osaBrakeMapping> mBrakeInfo;
-        std::map<int, AmpIO*> mUniqueBoards;
+        std::vector<AmpIO*> mUniqueBoards; // sorted by board ID
+        std::vector<int> mUniqueBoardIDs; // same order as mUniqueBoards
+        std::vector<const osaBoardSnapshot1394 *> mActuatorSnapshots, mBrakeSnapshots;
+        std::vector<const osaBoardSnapshot1394 *> mUniqueSnapshots; // same order as mUniqueBoards
 
         //! Robot Configuration
         osaRobot1394Configuration mConfiguration;
@@ -310,12 +363,56 @@ namespace sawRobotIO1394 {
             mBrakeCurrentFeedbackLimits,    // limit used to trigger error
             mPotsToEncodersTolerance;       // maximum error between encoders and pots
 
+        //! Scales, offsets and limits computed from the configuration
+        struct CalibrationTables {
+            vctDoubleVec
+                EffortToCurrentScales,
+                ActuatorCurrentToBitsScales,
+                ActuatorCurrentToBitsOffsets,
+                ActuatorBitsToCurrentScales,
+                ActuatorBitsToCurrentOffsets,
+                ActuatorCurrentCommandLimits,
+                ActuatorCurrentFeedbackLimits,
+                BitsToPositionScales,
+                BitsToPositionOffsets,
+                BitsToVoltageScales,
+                BitsToVoltageOffsets,
+                SensorToPositionScales,
+                SensorToPositionOffsets,
+                PositionMin,
+                PositionMax,
+                EffortMin,
+                EffortMax,
+                BrakeCurrentToBitsScales,
+                BrakeCurrentToBitsOffsets,
+                BrakeBitsToCurrentScales,
+                BrakeBitsToCurrentOffsets,
+                BrakeCurrentCommandLimits,
+                BrakeCurrentFeedbackLimits,
+                BrakeReleaseCurrent,
+                BrakeReleaseTime,
+                BrakeReleasedCurrent,
+                BrakeEngagedCurrent;
+            std::vector<osaPotTolerance1394Configuration> PotTolerances;
+        };
+        void ComputeCalibration(const osaRobot1394Configuration & config,
+                                CalibrationTables & tables) const;
+        //! Copy values, sizes must already match
+        void ApplyCalibration(const CalibrationTables & tables);
+
+        //! Staged calibration, filled by caller thread then applied by IO thread
+        CalibrationTables mStagedCalibration;
+        enum {CALIBRATION_IDLE, CALIBRATION_STAGING, CALIBRATION_READY};
+        std::atomic<int> mStagedCalibrationState {CALIBRATION_IDLE};
+
         //! Robot type
         osa1394::HardwareType mHardwareVersion;
         prmConfigurationJoint m_configuration_js;
         int mPotType = 0; // 0 for undefined, 1 for analog, 2 for digital (dVRK S)
         vctDoubleMat mPotCoupling;
+        osaPotCoupling1394 mPotCouplingKernel; // analysed at configuration, used to convert pots to actuator space
         bool mUsePotsForSafetyCheck;
+        osaPotEncoderCheck1394 mPotEncoderCheck; // in actuator space
 
         //! State Members
         bool
@@ -333,6 +430,7 @@ namespace sawRobotIO1394 {
 
         unsigned int mLowestFirmWareVersion;
         unsigned int mHighestFirmWareVersion;
+        std::string mBoardRobotSerialNumber; // dRA1, read from first board
 
         bool mSafetyRelay, mSafetyRelayStatus;
         bool mSafetyAmpDisabled = false; // disabled at firmware level
@@ -342,7 +440,6 @@ namespace sawRobotIO1394 {
             mBrakeAmpStatus,
             mActuatorAmpEnable,
             mBrakeAmpEnable,
-            mPotValid,
             mPreviousEncoderOverflow,
             mEncoderOverflow,
             mDigitalInputs,
@@ -374,9 +471,6 @@ namespace sawRobotIO1394 {
             mBrakeCurrentCommand,
             mActuatorEffortCommand,
             mActuatorCurrentFeedback,
-            mPotToleranceLatency,
-            mPotToleranceDistance,
-            mPotErrorDuration,
             mBrakeCurrentFeedback,
             mActuatorTemperature,
             mBrakeTemperature,
@@ -387,7 +481,7 @@ namespace sawRobotIO1394 {
 
         double mTimeLastPotentiometerMissingError = sawRobotIO1394::TimeBetweenPotentiometerMissingErrors;
 
-        vctDynamicVector<vctDoubleVec> mPotLookupTable;
+        osaPotLookupTable1394 mPotLookupTable;
 
         size_t
             mCurrentSafetyViolationsCounter,
@@ -401,6 +495,10 @@ namespace sawRobotIO1394 {
 
         mtsStateTable * mStateTableRead;
         mtsStateTable * mStateTableWrite;
+        mtsMessageQueue1394 * mMessageQueue = nullptr;
+        size_t mMessageSource = 0;
+        osaFault1394 mFault; // preallocated payload for fault events
+        double mFPGATime = 0.0; // cumulated time from first board timestamps
         bool mUserExpectsPower = false;
         double mPoweringStartTime;
 
@@ -417,6 +515,7 @@ namespace sawRobotIO1394 {
             mtsFunctionWrite WatchdogPeriod;
             mtsFunctionWrite BiasEncoder;
             mtsFunctionWrite UsePotsForSafetyCheck;
+            mtsFunctionWrite Fault;
         } EventTriggers;
 
         struct {
@@ -19,6 +19,8 @@ http://www.cisst.org/cisst/license.txt.
 #ifndef _mtsRobotIO1394_h
 #define _mtsRobotIO1394_h
 
+#include <atomic>
+#include <mutex>
 #include <ostream>
 #include <iostream>
 #include <vector>
@@ -26,6 +28,14 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsTaskPeriodic.h>
 #include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
 #include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+#include <sawRobotIO1394/osaDigitalInputEdgeQuery1394.h>
+#include <sawRobotIO1394/osaDigitalInputEngine1394.h>
+#include <sawRobotIO1394/osaDigitalInputHistory1394.h>
+#include <sawRobotIO1394/osaDigitalOutputBatch1394.h>
+#include <sawRobotIO1394/osaDigitalOutputValues1394.h>
+#include <sawRobotIO1394/osaReflexEngine1394.h>
+#include <sawRobotIO1394/osaStartupTrace1394.h>
 
 // Always include last!
 #include <sawRobotIO1394/sawRobotIO1394Export.h>
@@ -46,27 +56,93 @@ protected:
     bool mSkipConfigurationCheck = false;
     bool mCalibrationMode = false;
     std::string mSaveConfigurationJSON = "";
+    bool mUseConfigurationCache = false;
 
-    std::map<int, AmpIO*> mBoards;
-    typedef std::map<int, AmpIO*>::iterator board_iterator;
-    typedef std::map<int, AmpIO*>::const_iterator board_const_iterator;
+    // boards indexed by board ID, null if not used, and IDs of boards used
+    AmpIO * mBoards[MAX_BOARDS] = {};
+    std::vector<int> mBoardIDs;
+    AmpIO * UseBoard(const int boardID); // create the board and add it to the port if needed
+
+    // values extracted once per cycle for each board, indexed by board ID
+    sawRobotIO1394::osaBoardSnapshot1394 mBoardSnapshots[MAX_BOARDS];
+
+    // hardware/firmware versions and serial numbers, queried once per board used by robots
+    std::map<int, sawRobotIO1394::osaBoardInfo1394> mBoardInfo;
 
     std::vector<sawRobotIO1394::mtsRobot1394*> mRobots;
     std::map<std::string, sawRobotIO1394::mtsRobot1394*> mRobotsByName;
 
     std::vector<sawRobotIO1394::mtsDigitalInput1394*> mDigitalInputs;
     std::map<std::string, sawRobotIO1394::mtsDigitalInput1394*> mDigitalInputsByName;
+    sawRobotIO1394::osaDigitalInputEngine1394 mDigitalInputEngine; // only updates inputs with changed bits
+    // raw input words when changed, indexed by board ID, see digital_input_edges
+    sawRobotIO1394::osaDigitalInputHistory1394 mDigitalInputHistories[MAX_BOARDS];
+    size_t mDigitalInputHistorySize = 1024;
 
     std::vector<sawRobotIO1394::mtsDigitalOutput1394*> mDigitalOutputs;
     std::map<std::string, sawRobotIO1394::mtsDigitalOutput1394*> mDigitalOutputsByName;
+    // output changes requested during the cycle, indexed by board ID and flushed in Write
+    sawRobotIO1394::osaDigitalOutputBatch1394 mDigitalOutputBatches[MAX_BOARDS];
+
+    // input to output/power rules evaluated in PostRead
+    sawRobotIO1394::osaReflexEngine1394 mReflexEngine;
 
     std::vector<sawRobotIO1394::mtsDallasChip1394*> mDallasChips;
     std::map<std::string, sawRobotIO1394::mtsDallasChip1394*> mDallasChipsByName;
 
+    std::vector<sawRobotIO1394::mtsAnalogInput1394*> mAnalogInputs;
+    std::map<std::string, sawRobotIO1394::mtsAnalogInput1394*> mAnalogInputsByName;
+
     // state tables for statistics
     mtsStateTable * mStateTableRead;
     mtsStateTable * mStateTableWrite;
 
+    // last configuration applied for each file passed to Configure,
+    // used to compute differences on reconfigure.  Updated by the
+    // caller's thread (reload_calibration, reconfigure), the mutex is
+    // never used by the IO thread
+    std::mutex mPortConfigurationsMutex;
+    std::map<std::string, sawRobotIO1394::osaPort1394Configuration> mPortConfigurations;
+
+    // changes staged by Reconfigure, applied by the IO thread between
+    // cycles.  Everything is resolved and allocated by the caller's
+    // thread, the IO thread only copies values and swaps the digital
+    // input engine layout
+    struct PendingReconfiguration {
+        std::vector<std::pair<sawRobotIO1394::mtsDigitalInput1394 *,
+                              sawRobotIO1394::osaDigitalInput1394Configuration> > DigitalInputsChanged;
+        std::vector<std::pair<sawRobotIO1394::mtsDigitalOutput1394 *,
+                              sawRobotIO1394::osaDigitalOutput1394Configuration> > DigitalOutputsChanged;
+        std::vector<std::pair<sawRobotIO1394::mtsDallasChip1394 *,
+                              sawRobotIO1394::osaDallasChip1394Configuration> > DallasChipsChanged;
+        sawRobotIO1394::osaDigitalInputEngine1394 DigitalInputEngine; // new layout if inputs changed
+    };
+    PendingReconfiguration mPendingReconfiguration;
+    enum {RECONFIGURATION_IDLE, RECONFIGURATION_STAGING, RECONFIGURATION_READY};
+    std::atomic<int> mPendingReconfigurationState {RECONFIGURATION_IDLE};
+    void ApplyPendingReconfiguration(void); // IO thread
+
+    // messages for the configuration interface from commands not
+    // queued (reload_calibration, reconfigure), staged by the caller's
+    // thread and sent by the IO thread once the values they report on
+    // are applied
+    enum ConfigurationMessageType {CONFIGURATION_STATUS, CONFIGURATION_WARNING, CONFIGURATION_ERROR};
+    struct ConfigurationMessage {
+        ConfigurationMessageType Type;
+        std::string Text;
+    };
+    std::mutex mConfigurationMessagesMutex;
+    std::vector<ConfigurationMessage> mConfigurationMessagesStaged, mConfigurationMessagesToSend;
+    void StageConfigurationMessage(const ConfigurationMessageType type, const std::string & text);
+    void TakeConfigurationMessages(void); // IO thread
+    void SendConfigurationMessages(void); // IO thread
+
+    // messages from the IO thread, formatted and rate limited in a separate thread
+    sawRobotIO1394::mtsMessageQueue1394 * mMessageQueue = nullptr;
+
+    // opt-in trace of Init, Configure and Startup, saved at the end of Startup
+    sawRobotIO1394::osaStartupTrace1394 mStartupTrace;
+
     ///////////// Public Class Methods ///////////////////////////
 public:
     // Constructor & Destructor
@@ -82,16 +158,25 @@ public:
     void SkipConfigurationCheck(const bool skip); // must be called before Configure
     void SetCalibrationMode(const bool & mode); // must be called before Configure.  When calibrating, some values might be missing (e.g. lookup table to Si pots
     void SaveConfigurationJSON(const std::string & filename); // must be called before Configure
-    void Configure(const std::string & filename) override;
+    void UseConfigurationCache(const bool use); // must be called before Configure.  Load from/save to <filename>.cache, rebuilt when the configuration or lookup table files change
+    void SetStartupTrace(const std::string & filename); // must be called before Configure.  Chrome trace event file saved at the end of Startup, Init is only traced using the environment variable SAW_ROBOT_IO_1394_STARTUP_TRACE
+    void SetDigitalInputHistorySize(const size_t size); // must be called before Configure.  Number of changed input words kept per board, 0 to disable
+    void Configure(const std::string & filename) override; // XML or JSON (.json extension, see SaveConfigurationJSON)
+    bool LoadConfiguration(const std::string & filename,
+                           sawRobotIO1394::osaPort1394Configuration & config) const; // XML or JSON, returns false on error
     bool SetupRobot(sawRobotIO1394::mtsRobot1394 * robot);
     bool SetupDigitalInput(sawRobotIO1394::mtsDigitalInput1394 * digitalInput);
     bool SetupDigitalOutput(sawRobotIO1394::mtsDigitalOutput1394 * digitalOutput);
     bool SetupDallasChip(sawRobotIO1394::mtsDallasChip1394 * dallasChip);
+    bool SetupAnalogInput(sawRobotIO1394::mtsAnalogInput1394 * analogInput);
     void AddRobot(sawRobotIO1394::mtsRobot1394 * Robot);
     void AddDigitalInput(sawRobotIO1394::mtsDigitalInput1394 * digitalInput);
     void AddDigitalOutput(sawRobotIO1394::mtsDigitalOutput1394 * digitalInput);
     void AddDallasChip(sawRobotIO1394::mtsDallasChip1394 * dallasChip);
+    void AddAnalogInput(sawRobotIO1394::mtsAnalogInput1394 * analogInput);
+    void AddReflex(const sawRobotIO1394::osaReflex1394Configuration & config); // inputs, outputs and robots used must be added first
 
+    void QueryBoards(void); // called by Configure once all robots have been added
     bool CheckFirmwareVersions(void);
 
     void Startup(void) override;
@@ -101,6 +186,7 @@ public:
     sawRobotIO1394::mtsDigitalInput1394 * DigitalInput(const size_t index);
     const sawRobotIO1394::mtsDigitalInput1394* DigitalInput(const size_t index) const;
     void GetNumberOfDigitalOutputs(size_t & placeHolder) const;
+    void GetNumberOfAnalogInputs(size_t & placeHolder) const;
 
     // public so these can be used outside cisstMultiTask
     bool IsOK(void) const;
@@ -113,6 +199,48 @@ public:
     static std::string DefaultPort(void);
     void close_all_relays(void);
 
+    /*! Set multiple digital outputs in the same cycle.  Outputs on
+      the same board are written together (see
+      osaDigitalOutputBatch1394).  Nothing is set if any name is
+      unknown. */
+    void set_digital_outputs(const sawRobotIO1394::osaDigitalOutputValues1394 & values);
+
+    /*! Edges on one digital input bit since a given FPGA time, from
+      the history of raw input words (see
+      osaDigitalInputHistory1394).  Lets slow clients find short
+      pulses without subscribing to all events.  Not queued, the
+      history is copied in the caller's thread.  Errors (unknown input,
+      board or bit) are returned in the result, see
+      osaDigitalInputEdges1394::Message. */
+    void digital_input_edges(const sawRobotIO1394::osaDigitalInputEdgeQuery1394 & query,
+                             sawRobotIO1394::osaDigitalInputEdges1394 & edges) const;
+
+    /*! Load scales, offsets, limits and pot tolerances from a new
+      configuration file and apply them between two IO cycles.  The
+      hardware layout (boards, axes, pot types, brakes) must be the
+      same as the current configuration.  Pot lookup tables and
+      coupling are not reloaded.  The result is sent by the IO thread
+      once the staged values are applied, as an error if any robot
+      couldn't be staged. */
+    void reload_calibration(const std::string & filename);
+
+    /*! Apply only the differences between the configuration loaded
+      from the same file by Configure and a new one (see
+      osaConfigurationDiff1394), elements configured from other files
+      are not considered.  Robots with new calibration values are
+      staged as with reload_calibration, digital inputs, outputs and
+      Dallas chips can be changed in place and are applied by the IO
+      thread between two cycles.  Unchanged elements and their state
+      tables are left untouched.  Nothing is applied if any change
+      requires a restart (e.g. new robot, new digital input or layout
+      change).  The message contains a summary of the differences
+      found, reconfigure sends it from the IO thread once the changes
+      are applied. */
+    bool Reconfigure(const std::string & filename,
+                     const sawRobotIO1394::osaPort1394Configuration & config,
+                     std::string & message);
+    void reconfigure(const std::string & filename);
+
 protected:
     void GetNumberOfBoards(size_t & placeHolder) const;
     void GetNumberOfActuatorsPerRobot(vctIntVec & placeHolder) const;
@@ -122,6 +250,7 @@ protected:
     void GetRobotNames(std::vector<std::string> & names) const;
     void GetDigitalInputNames(std::vector<std::string> & names) const;
     void GetDigitalOutputNames(std::vector<std::string> & names) const;
+    void GetAnalogInputNames(std::vector<std::string> & names) const;
 
     void PreRead(void);
     void PostRead(void);
@@ -132,6 +261,10 @@ protected:
 private:
     double mTimeLastTimingWarning = 0.0;
 
+    // write to boards and flush digital output batches, used by Write
+    // and Cleanup (no sequences, triggers nor holds)
+    void WriteBoards(void);
+
 private:
     // Make uncopyable
     mtsRobotIO1394(const mtsRobotIO1394 &);
@@ -0,0 +1,96 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaAnalogFilter1394_h
+#define _osaAnalogFilter1394_h
+
+#include <string>
+#include <vector>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Filter, decimation and window statistics for analog inputs,
+      see mtsAnalogInput1394.  Samples go through the optional FIR
+      filter, then the first order IIR filter.  The filtered value is
+      published every Decimation samples and min, max and mean are
+      computed over Window filtered samples.  Buffers are allocated in
+      Configure, Step doesn't allocate memory. */
+    class CISST_EXPORT osaAnalogFilter1394 {
+    public:
+        /*! Returns false and a message if the parameters are not
+          valid, the filter is then left unchanged. */
+        bool Configure(const std::vector<double> & fir,
+                       const double iir,
+                       const int decimation,
+                       const int window,
+                       std::string & message);
+
+        //! Forget previous samples
+        void Reset(void);
+
+        /*! Add a sample.  Returns true when a new decimated value is
+          available, see Value. */
+        bool Step(const double sample);
+
+        inline double Value(void) const {
+            return mValue;
+        }
+
+        //! True when a window has been completed by the last Step
+        inline bool WindowCompleted(void) const {
+            return mWindowCompleted;
+        }
+
+        //! Statistics of the last completed window
+        //@{
+        inline double Minimum(void) const {
+            return mMinimum;
+        }
+        inline double Maximum(void) const {
+            return mMaximum;
+        }
+        inline double Mean(void) const {
+            return mMean;
+        }
+        //@}
+
+    protected:
+        std::vector<double> mFIR;
+        std::vector<double> mHistory; // circular, same size as mFIR
+        size_t mHistoryIndex = 0;
+        size_t mNumberOfSamples = 0;  // until history is full
+        double mIIR = 1.0;
+        double mFiltered = 0.0;
+        int mDecimation = 1;
+        int mDecimationCounter = 0;
+        double mValue = 0.0;
+
+        int mWindow = 0;
+        int mWindowCounter = 0;
+        double mWindowMinimum, mWindowMaximum, mWindowSum;
+        bool mWindowCompleted = false;
+        double mMinimum = 0.0;
+        double mMaximum = 0.0;
+        double mMean = 0.0;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaAnalogFilter1394_h
@@ -0,0 +1,64 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaBoardSnapshot1394_h
+#define _osaBoardSnapshot1394_h
+
+#include <cstdint>
+
+#include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Board level values extracted once per cycle, right after the
+      port has read all boards.  Boards can be shared by multiple
+      robots, digital inputs... so these read from the snapshot
+      instead of calling AmpIO for each actuator or input.
+      mtsRobotIO1394 keeps one snapshot per board ID. */
+    struct CISST_EXPORT osaBoardSnapshot1394 {
+        enum {MAX_TEMPERATURES = 4}; // one sensor per pair of axes, up to 8 axes (DQLA)
+
+        bool Valid = false;
+        bool PowerEnable = false;
+        bool PowerStatus = false;
+        bool PowerFault = false;
+        bool SafetyRelay = false;
+        bool SafetyRelayStatus = false;
+        bool WatchdogTimeoutStatus = false;
+        uint32_t SafetyAmpDisable = 0;
+
+        double TimestampSeconds = 0.0; // time since previous read, FPGA clock
+        double FPGATime = 0.0; // cumulated TimestampSeconds, used to timestamp events
+        uint32_t DigitalInput = 0;
+
+        //! Temperatures in Celsius, only the sensors used by actuators or brakes are read
+        size_t NumberOfTemperatures = 0;
+        double AmpTemperature[MAX_TEMPERATURES] = {0.0, 0.0, 0.0, 0.0};
+
+        //! Make sure the temperature sensor for this axis is read
+        void UseTemperatureForAxis(const int axis);
+
+        //! Extract all values, board must have been read
+        void Update(AmpIO & board);
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaBoardSnapshot1394_h
@@ -0,0 +1,58 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaConfigurationCache1394_h
+#define _osaConfigurationCache1394_h
+
+#include <cstdint>
+#include <string>
+
+#include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Binary cache for parsed port configurations.  The cache file
+      contains a header with the list of files the configuration was
+      built from (configuration file and pot lookup tables) along with
+      a hash of their content, followed by osaPort1394Configuration in
+      cisst binary format.  The cache is only used if all hashes still
+      match and the calibration mode is the same, otherwise the caller
+      is expected to parse the configuration and save a new cache.
+      The cache format is host specific (endianness, size of types)
+      and should not be shared between computers. */
+
+    //! 64 bits FNV-1a hash, returns false if the file can't be read
+    bool CISST_EXPORT osaConfigurationCache1394HashFile(const std::string & filename,
+                                                        uint64_t & hash);
+
+    /*! Load the configuration from cache, returns false if the cache
+      doesn't exist, is corrupted or out of date. */
+    bool CISST_EXPORT osaConfigurationCache1394Load(const std::string & cacheFile,
+                                                    osaPort1394Configuration & config,
+                                                    const bool & calibrationMode);
+
+    /*! Save the configuration along with the hash of the configuration
+      file and all lookup table files referenced by the robots. */
+    bool CISST_EXPORT osaConfigurationCache1394Save(const std::string & cacheFile,
+                                                    const std::string & configFile,
+                                                    const osaPort1394Configuration & config,
+                                                    const bool & calibrationMode);
+
+} // namespace sawRobotIO1394
+
+#endif // _osaConfigurationCache1394_h
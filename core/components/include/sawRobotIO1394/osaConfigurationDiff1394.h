@@ -0,0 +1,90 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaConfigurationDiff1394_h
+#define _osaConfigurationDiff1394_h
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Differences between two port configurations.  Elements are
+      matched by name.  Robots are either unchanged, changed in ways
+      that can be applied while running (scales, offsets, limits, pot
+      tolerances, see mtsRobot1394::StageCalibration) or changed in
+      their layout (boards, axes, joint or pot types, brakes, lookup
+      tables, coupling...) which requires a restart.  Digital inputs,
+      outputs and Dallas chips can be changed in place but adding or
+      removing one requires a restart since state tables and
+      interfaces can't be created while running.  Reflex rules and
+      analog inputs can't be changed while running.  Indices refer to
+      the new configuration. */
+    struct CISST_EXPORT osaConfigurationDiff1394 {
+        std::vector<size_t> RobotsCalibrationChanged;
+        std::vector<std::string> RobotsLayoutChanged, RobotsAdded, RobotsRemoved;
+
+        std::vector<size_t> DigitalInputsChanged, DigitalInputsAdded;
+        std::vector<std::string> DigitalInputsRemoved;
+
+        std::vector<size_t> DigitalOutputsChanged, DigitalOutputsAdded;
+        std::vector<std::string> DigitalOutputsRemoved;
+
+        std::vector<size_t> DallasChipsChanged, DallasChipsAdded;
+        std::vector<std::string> DallasChipsRemoved;
+
+        bool ReflexesChanged = false;
+        bool AnalogInputsChanged = false;
+
+        //! No difference found
+        bool Empty(void) const;
+
+        //! Some changes can't be applied while running
+        bool RequiresRestart(void) const;
+
+        void Clear(void);
+
+        //! Human readable summary
+        void ToStream(std::ostream & output,
+                      const osaPort1394Configuration & next) const;
+    };
+
+    /*! Compute the differences between the current and next
+      configurations. */
+    void CISST_EXPORT osaConfigurationDiff1394Compute(const osaPort1394Configuration & current,
+                                                      const osaPort1394Configuration & next,
+                                                      osaConfigurationDiff1394 & diff);
+
+    /*! Same layout, i.e. the next configuration can be applied using
+      mtsRobot1394::StageCalibration.  Same checks as
+      mtsRobot1394::CheckCalibration plus settings that are only used
+      at configuration time (lookup tables, coupling, serial
+      number...). */
+    bool CISST_EXPORT osaConfigurationDiff1394SameLayout(const osaRobot1394Configuration & current,
+                                                         const osaRobot1394Configuration & next);
+
+    /*! Same scales, offsets, limits and pot tolerances. */
+    bool CISST_EXPORT osaConfigurationDiff1394SameCalibration(const osaRobot1394Configuration & current,
+                                                              const osaRobot1394Configuration & next);
+
+} // namespace sawRobotIO1394
+
+#endif // _osaConfigurationDiff1394_h
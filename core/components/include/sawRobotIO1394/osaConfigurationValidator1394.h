@@ -0,0 +1,66 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaConfigurationValidator1394_h
+#define _osaConfigurationValidator1394_h
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    //! Problem found in a configuration file
+    struct osaConfigurationIssue1394 {
+        typedef enum {ISSUE_WARNING, ISSUE_ERROR} SeverityType;
+        SeverityType Severity;
+        std::string File;
+        size_t Line; // 0 if unknown
+        std::string Context; // e.g. Robot[0]/Actuator[2]
+        std::string Message;
+    };
+
+    std::ostream CISST_EXPORT & operator << (std::ostream & output,
+                                             const osaConfigurationIssue1394 & issue);
+
+    /*! Validate a configuration file (XML or JSON) without accessing
+      the hardware.  XML files are parsed in calibration mode so missing
+      lookup tables don't stop the parsing, the lookup table files are
+      then checked separately.  Contrary to mtsRobotIO1394::Configure, all
+      problems found are reported, not just the first one.  Line
+      numbers are found by searching the file content and are best
+      effort.  Different files can be validated in parallel.  Returns
+      false if any error was found. */
+    bool CISST_EXPORT osaConfigurationValidator1394Check(const std::string & filename,
+                                                         std::vector<osaConfigurationIssue1394> & issues);
+
+    /*! Checks on a parsed configuration: units vs joint types, pot
+      tolerances, equal current offsets (see
+      mtsRobot1394::CheckConfiguration), duplicate board/axis and pot
+      lookup tables.  fileContent is only used to find line numbers
+      and can be empty. */
+    bool CISST_EXPORT osaConfigurationValidator1394CheckPort(const osaPort1394Configuration & config,
+                                                             const std::string & filename,
+                                                             const std::string & fileContent,
+                                                             std::vector<osaConfigurationIssue1394> & issues);
+
+} // namespace sawRobotIO1394
+
+#endif // _osaConfigurationValidator1394_h
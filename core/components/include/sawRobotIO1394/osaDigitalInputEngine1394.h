@@ -0,0 +1,80 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaDigitalInputEngine1394_h
+#define _osaDigitalInputEngine1394_h
+
+#include <cstdint>
+#include <vector>
+
+#include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    struct osaBoardSnapshot1394;
+
+    /*! Digital inputs grouped by board.  Each cycle, the board's input
+      word is compared to the previous one (XOR) and only the inputs
+      with a changed bit or still busy (first run, debouncing, event
+      to send) are updated.  Inputs must be added after their board
+      snapshot has been set, see mtsDigitalInput1394::SetBoardSnapshot.
+      PollState, CheckState and Swap don't allocate memory. */
+    class CISST_EXPORT osaDigitalInputEngine1394 {
+    public:
+        void Clear(void);
+        void Add(mtsDigitalInput1394 * input);
+
+        /*! Add with the board snapshot and bit mask the input will use,
+          to build a new layout before the input is reconfigured */
+        void Add(mtsDigitalInput1394 * input,
+                 const osaBoardSnapshot1394 * snapshot,
+                 const uint32_t bitMask);
+
+        //! Exchange layouts, used to apply a layout built by another thread
+        void Swap(osaDigitalInputEngine1394 & other);
+
+        //! Update inputs, to be called after the board snapshots are updated
+        void PollState(void);
+
+        //! Send events for inputs updated by the last PollState
+        void CheckState(void);
+
+        //! Number of inputs updated by the last PollState
+        inline size_t NumberOfInputsPolled(void) const {
+            return mPolled.size();
+        }
+
+    protected:
+        struct Board {
+            const osaBoardSnapshot1394 * Snapshot;
+            uint32_t PreviousBits;
+            uint32_t ActiveMask; // bits for inputs that need to be updated next cycle
+            std::vector<mtsDigitalInput1394 *> Inputs;
+        };
+        std::vector<Board> mBoards;
+
+        // inputs updated this cycle
+        std::vector<mtsDigitalInput1394 *> mPolled;
+        size_t mNumberOfInputs = 0;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaDigitalInputEngine1394_h
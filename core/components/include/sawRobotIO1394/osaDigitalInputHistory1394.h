@@ -0,0 +1,95 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaDigitalInputHistory1394_h
+#define _osaDigitalInputHistory1394_h
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Ring of raw digital input words for one board with their FPGA
+      times, see osaBoardSnapshot1394.  A word is only added when it
+      differs from the previous one so the history covers long periods
+      when inputs don't change.  Updated by the IO thread and queried
+      by other threads (see mtsRobotIO1394::digital_input_edges).
+      Update never waits for the mutex: if a query holds it, changed
+      words are kept in a small buffer and added on the next update
+      that gets the mutex.  Queries only hold the mutex to copy the
+      words into a buffer allocated beforehand, edges are found after
+      releasing it.  SetCapacity and Clear must not be called while
+      another thread calls Update. */
+    class CISST_EXPORT osaDigitalInputHistory1394 {
+    public:
+        //! Number of changed words kept while the mutex is busy
+        enum {PENDING_SIZE = 16};
+
+        /*! Number of words kept, 0 (default) to disable.  Memory is
+          allocated here, history is cleared. */
+        void SetCapacity(const size_t capacity);
+        size_t Capacity(void) const;
+
+        void Clear(void);
+
+        /*! Called once per cycle, word is only added if changed.
+          Doesn't block nor allocate memory. */
+        void Update(const double time, const uint32_t word);
+
+        /*! Edges on any bit of the mask after time since, oldest
+          first.  values contains the new state of the masked bits
+          (true if any is set).  lastTime is the time of the last
+          update added to the history.  Returns false if words after
+          since have been overwritten or dropped, i.e. some edges might
+          be missing. */
+        bool Edges(const uint32_t mask, const double since,
+                   std::vector<double> & times, std::vector<bool> & values,
+                   double & lastTime) const;
+
+    protected:
+        struct Entry {
+            double Time;
+            uint32_t Word;
+        };
+        void Add(const Entry & entry); // mutex must be locked
+
+        mutable std::mutex mMutex;
+        size_t mCapacity = 0;
+        std::vector<Entry> mEntries;
+        size_t mNext = 0;           // where next word goes
+        size_t mSize = 0;           // number of valid entries
+        bool mOverwritten = false;  // oldest words have been dropped
+        bool mLost = false;         // words dropped while the mutex was busy
+        double mLostTime = 0.0;     // time of the last word dropped
+        double mLastTime = 0.0;
+
+        // only used by the IO thread, see Update
+        bool mHasLastWord = false;
+        uint32_t mLastWord = 0;
+        Entry mPending[PENDING_SIZE];
+        size_t mNumberOfPending = 0;
+        bool mPendingLost = false;
+        double mPendingLostTime = 0.0;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaDigitalInputHistory1394_h
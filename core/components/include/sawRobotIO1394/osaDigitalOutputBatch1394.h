@@ -0,0 +1,71 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaDigitalOutputBatch1394_h
+#define _osaDigitalOutputBatch1394_h
+
+#include <cstdint>
+
+#include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Digital output changes requested during a cycle for one board.
+      mtsDigitalOutput1394::SetValue only updates the masks,
+      mtsRobotIO1394::Write flushes them with a single masked write
+      per board so outputs changed in the same cycle don't overwrite
+      each other's bits.  The last request for a given bit wins. */
+    struct CISST_EXPORT osaDigitalOutputBatch1394 {
+        uint32_t SetMask = 0;
+        uint32_t ClearMask = 0;
+
+        inline void Request(const uint32_t mask, const bool value) {
+            if (value) {
+                SetMask |= mask;
+                ClearMask &= ~mask;
+            } else {
+                ClearMask |= mask;
+                SetMask &= ~mask;
+            }
+        }
+
+        inline bool Pending(void) const {
+            return (SetMask | ClearMask) != 0;
+        }
+
+        //! Bits after applying the pending changes
+        inline uint32_t Apply(const uint32_t bits) const {
+            return (bits | SetMask) & ~ClearMask;
+        }
+
+        inline void Clear(void) {
+            SetMask = 0;
+            ClearMask = 0;
+        }
+
+        /*! Write pending changes to the board, only the bits changed
+          are written.  Returns false if the write failed, pending
+          changes are dropped either way. */
+        bool Flush(AmpIO & board);
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaDigitalOutputBatch1394_h
@@ -0,0 +1,71 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaDigitalOutputSequencer1394_h
+#define _osaDigitalOutputSequencer1394_h
+
+#include <string>
+
+#include <sawRobotIO1394/osaDigitalOutputSequence1394.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Plays a timed sequence of output values from the IO thread,
+      see mtsDigitalOutput1394::PlaySequence.  Time is advanced using
+      the time elapsed between board reads so steps change on the
+      first cycle past their end.  The remainder is carried over to
+      the next step so long sequences don't drift.  Whole repetitions
+      elapsed during a single cycle are skipped so the cost of a step
+      is bounded by the number of values, even for durations much
+      shorter than the IO period. */
+    class CISST_EXPORT osaDigitalOutputSequencer1394 {
+    public:
+        /*! Start a new sequence, returns false and a message if the
+          sequence is not valid (sizes, negative or null durations).
+          The current sequence is not changed in this case. */
+        bool Start(const osaDigitalOutputSequence1394 & sequence,
+                   std::string & message);
+
+        void Stop(void);
+
+        inline bool Playing(void) const {
+            return mPlaying;
+        }
+
+        /*! Advance by the time elapsed since the previous step.
+          Returns true if the output should be set to a new value.
+          The first call after Start always returns the first value,
+          the sequence stops after the last step of the last
+          repetition and the last value is kept. */
+        bool Step(const double elapsedTime, double & value);
+
+    protected:
+        osaDigitalOutputSequence1394 mSequence;
+        bool mPlaying = false;
+        bool mFirstStep = false;
+        size_t mIndex = 0;
+        unsigned int mRepetition = 0;
+        double mTimeInStep = 0.0;
+        double mPeriod = 0.0; // sum of durations
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaDigitalOutputSequencer1394_h
@@ -0,0 +1,88 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaJSON1394_h
+#define _osaJSON1394_h
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnDataFunctionsJSON.h>
+#include <sawRobotIO1394/osaConfiguration1394.h>
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    template <typename _elementType>
+    bool osaJSON1394GetValue(const Json::Value & jsonValue, const std::string & context, const char * name,
+                             _elementType & value, bool required = true) {
+        // const operator[] doesn't create missing members
+        const Json::Value & member = jsonValue[name];
+        if (member.isNull()) {
+            if (required) {
+                CMN_LOG_INIT_ERROR << "osaJSON1394GetValue: " << name << " in context " << context << " is required but not found" << std::endl;
+                return false;
+            }
+            return true;
+        }
+        try {
+            cmnDataJSON<_elementType>::DeSerializeText(value, member);
+        } catch (std::exception & e) {
+            CMN_LOG_INIT_ERROR << "osaJSON1394GetValue: failed to parse " << name << " in context " << context
+                               << ": " << e.what() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    /*! Load a port configuration from a JSON file using the same
+      schema as osaPort1394Configuration::SerializeTextJSON, i.e. files
+      created with mtsRobotIO1394::SaveConfigurationJSON.  The JSON
+      tree is traversed once and each member is deserialized directly
+      with cmnDataJSON, there is no per attribute query like for the
+      XML files.  Values are checked the same way as in
+      osaXML1394ConfigurePort. */
+    void CISST_EXPORT osaJSON1394ConfigurePort(const std::string & filename,
+                                               osaPort1394Configuration & config,
+                                               const bool & calibrationMode);
+
+    //! Same as osaJSON1394ConfigurePort but returns false on error instead of exiting
+    bool CISST_EXPORT osaJSON1394LoadPort(const std::string & filename,
+                                          osaPort1394Configuration & config,
+                                          const bool & calibrationMode);
+
+    bool CISST_EXPORT osaJSON1394ConfigureRobot(const Json::Value & jsonRobot,
+                                                const std::string & context,
+                                                osaRobot1394Configuration & robot,
+                                                const bool & calibrationMode);
+
+    bool CISST_EXPORT osaJSON1394ConfigureActuator(const Json::Value & jsonActuator,
+                                                   const std::string & context,
+                                                   const bool onlyIO,
+                                                   osaActuator1394Configuration & actuator);
+
+    //! Only Input is required, other members keep their default values if missing
+    bool CISST_EXPORT osaJSON1394ConfigureReflex(const Json::Value & jsonReflex,
+                                                 const std::string & context,
+                                                 osaReflex1394Configuration & reflex);
+
+    //! Name, BoardID and AxisID are required, other members keep their default values if missing
+    bool CISST_EXPORT osaJSON1394ConfigureAnalogInput(const Json::Value & jsonAnalogInput,
+                                                      const std::string & context,
+                                                      osaAnalogInput1394Configuration & analogInput);
+
+} // namespace sawRobotIO1394
+
+#endif // _osaJSON1394_h
@@ -0,0 +1,77 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaPotCoupling1394_h
+#define _osaPotCoupling1394_h
+
+#include <string>
+#include <vector>
+
+#include <cisstVector/vctDynamicVectorTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Linear map used to convert potentiometer positions to actuator
+      space.  The matrix is analysed once in Configure and Apply uses
+      the cheapest kernel for its structure.  Most couplings (e.g. MTM
+      JointToActuatorPosition) are the identity with a couple of off
+      diagonal terms so a compressed sparse row (CSR) product is much
+      cheaper than the dense matrix-vector product.  Banded matrices
+      are handled by the CSR kernel. */
+    class CISST_EXPORT osaPotCoupling1394 {
+    public:
+        typedef enum {NONE, IDENTITY, PERMUTATION, SPARSE, DENSE} KernelType;
+
+        /*! Analyse the matrix.  Coefficients with an absolute value
+          lower or equal to tolerance are considered null.  An empty
+          matrix means no coupling, i.e. output is a copy of the
+          input. */
+        void Configure(const vctDoubleMat & coupling,
+                       const double tolerance = 0.0);
+
+        /*! Compute output = coupling * input.  The output vector must
+          already have the right size and can't be the input. */
+        void Apply(const vctDoubleVec & input,
+                   vctDoubleVec & output) const;
+
+        inline KernelType Kernel(void) const {
+            return mKernel;
+        }
+
+        /*! Number of non null coefficients */
+        inline size_t NumberOfNonZeros(void) const {
+            return mValues.size();
+        }
+
+        static std::string KernelToString(const KernelType kernel);
+
+    protected:
+        KernelType mKernel = NONE;
+        vctDoubleMat mDense;
+        //! For permutation, output[i] = input[mColumns[i]]
+        std::vector<size_t> mRowStart;
+        std::vector<size_t> mColumns;
+        std::vector<double> mValues;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaPotCoupling1394_h
@@ -0,0 +1,106 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaPotEncoderCheck1394_h
+#define _osaPotEncoderCheck1394_h
+
+#include <vector>
+
+#include <cisstVector/vctDynamicVectorTypes.h>
+#include <sawRobotIO1394/osaConfiguration1394.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Consistency check between encoders and potentiometers.  Both
+      positions must be provided in actuator space, i.e. pots after
+      the JointToActuatorPosition coupling.  For each actuator, the
+      difference pot - encoder is averaged over a sliding window
+      (running sum so the cost doesn't depend on the window size,
+      replaced by a sum of the new samples each time the window wraps
+      so rounding errors don't accumulate),
+      the check starts once the window is full.
+      Averaging the difference rather than the pot alone filters the
+      pot noise without adding lag when the arm moves.  An actuator
+      becomes invalid when the averaged error stays above the
+      tolerance distance for longer than the latency, using its own
+      board timestamp.  It becomes valid again once the error is
+      below distance - hysteresis. */
+    class CISST_EXPORT osaPotEncoderCheck1394 {
+    public:
+        void Configure(const std::vector<osaPotTolerance1394Configuration> & tolerances);
+
+        /*! Change distance, latency and hysteresis without any memory
+          allocation nor reset.  Returns false if the number of
+          actuators or any window size is different from the ones used
+          in Configure. */
+        bool UpdateTolerances(const std::vector<osaPotTolerance1394Configuration> & tolerances);
+
+        /*! Clear windows and durations, all actuators are valid */
+        void Reset(void);
+
+        /*! Update the check.  elapsed is the time since last call for
+          each actuator.  Returns true if any actuator changed
+          status, use NewlyInvalid to find which actuators just
+          tripped.  Actuators with a distance of 0 are not checked and
+          considered valid. */
+        bool Check(const vctDoubleVec & pots,
+                   const vctDoubleVec & encoders,
+                   const vctDoubleVec & elapsed);
+
+        inline bool AllValid(void) const {
+            return mNumberOfInvalid == 0;
+        }
+        inline const vctBoolVec & Valid(void) const {
+            return mValid;
+        }
+        inline const vctBoolVec & NewlyInvalid(void) const {
+            return mNewlyInvalid;
+        }
+        //! Averaged pot - encoder error
+        inline const vctDoubleVec & Error(void) const {
+            return mError;
+        }
+        inline const vctDoubleVec & ErrorDuration(void) const {
+            return mErrorDuration;
+        }
+        inline const vctDoubleVec & Distance(void) const {
+            return mDistance;
+        }
+
+    protected:
+        void SetTolerance(const size_t index,
+                          const osaPotTolerance1394Configuration & tolerance);
+        static size_t WindowSize(const osaPotTolerance1394Configuration & tolerance);
+
+        size_t mNumberOfActuators = 0;
+        size_t mNumberOfInvalid = 0;
+        vctDoubleVec mDistance, mLatency, mRecovery;
+        vctDoubleVec mError, mErrorDuration;
+        vctBoolVec mValid, mNewlyInvalid;
+
+        //! Sliding windows, all stored in a single buffer
+        std::vector<size_t> mWindowSize, mWindowStart, mWindowHead, mWindowCount;
+        std::vector<double> mWindowBuffer;
+        vctDoubleVec mWindowSum, mWindowNextSum;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaPotEncoderCheck1394_h
@@ -0,0 +1,100 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaPotLookupTable1394_h
+#define _osaPotLookupTable1394_h
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cisstVector/vctDynamicVectorTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Lookup tables used to convert digital pot values to SI
+      positions (dRA1 controllers).  All tables are packed in a single
+      row major matrix, one row per actuator.  Entries with the
+      missing value (see mtsRobot1394::GetMissingPotValue) are
+      recorded in a bitmap when the table is set.  Optionally, gaps
+      between valid entries can be filled using a linear interpolation
+      so only the entries before the first and after the last valid
+      entries are considered missing.  At runtime, raw values are
+      clamped to the table size (values out of range are reported as
+      missing) and read without bounds checking. */
+    class CISST_EXPORT osaPotLookupTable1394 {
+    public:
+        /*! Allocate memory for all tables, the number of entries is
+          the size of the largest table. */
+        void SetSize(const size_t numberOfActuators,
+                     const size_t numberOfEntries);
+
+        /*! Set table for a given actuator.  Returns the number of
+          missing entries after interpolation (if requested). */
+        size_t SetTable(const size_t actuator,
+                        const vctDoubleVec & table,
+                        const bool interpolateGaps = false);
+
+        /*! Convert raw pot values to positions, check AnyMissing
+          and Missing after the conversion */
+        void Lookup(const vctIntVec & raw,
+                    vctDoubleVec & positions);
+
+        inline bool AnyMissing(void) const {
+            return mAnyMissing;
+        }
+
+        inline const vctBoolVec & Missing(void) const {
+            return mMissing;
+        }
+
+        inline size_t NumberOfEntries(void) const {
+            return mTables.cols();
+        }
+
+    protected:
+        vctDoubleMat mTables;
+        //! Valid index range per actuator
+        std::vector<int> mLastIndex;
+        //! One bit per entry, 1 for missing
+        std::vector<uint64_t> mMissingBits;
+        size_t mWordsPerActuator = 0;
+        vctBoolVec mMissing;
+        bool mAnyMissing = false;
+    };
+
+    /*! Read a lookup table file, i.e. a JSON object with the robot
+      serial number as "serial" and one array of values per actuator
+      as "lookup".  The file is parsed in a single pass without
+      building a JSON tree, each row is parsed in a scratch buffer
+      and copied directly into the table provided by the caller
+      (e.g. osaPot1394Configuration::LookupTable).  Returns false if
+      the file can't be parsed, the number of rows doesn't match the
+      number of tables provided or a row is empty.  Values are parsed
+      with strtod so the C locale is expected. */
+    bool CISST_EXPORT osaPotLookupTable1394ReadFile(const std::string & filename,
+                                                    std::string & serialNumber,
+                                                    const std::vector<vctDoubleVec *> & tables,
+                                                    std::string & errorMessage);
+
+} // namespace sawRobotIO1394
+
+#endif // _osaPotLookupTable1394_h
@@ -0,0 +1,80 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaReflexEngine1394_h
+#define _osaReflexEngine1394_h
+
+#include <vector>
+
+#include <sawRobotIO1394/sawRobotIO1394ForwardDeclarations.h>
+
+// Always include last
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Rules mapping digital inputs to digital outputs or robot power
+      (see osaReflex1394Configuration), evaluated by mtsRobotIO1394
+      right after the inputs are updated so the reaction is written in
+      the same IO cycle.  Names are resolved to pointers when rules are
+      added, Evaluate doesn't allocate memory.  While a rule is
+      active its output is held (see mtsDigitalOutput1394::Hold) so
+      client commands can't override it, a sequence playing on the
+      output is not stopped and resumes once the rule is released. */
+    class CISST_EXPORT osaReflexEngine1394 {
+    public:
+        struct Rule {
+            const mtsDigitalInput1394 * Input = nullptr;
+            bool WhenPressed = true;
+            mtsDigitalOutput1394 * Output = nullptr; // optional
+            bool OutputValue = true;
+            mtsRobot1394 * Robot = nullptr;          // optional, powered off
+        };
+
+        void Clear(void);
+        void Add(const Rule & rule);
+
+        inline size_t size(void) const {
+            return mRules.size();
+        }
+
+        //! Apply rules, outputs are held or released when the rule's state changes
+        void Evaluate(void);
+
+        //! Rule state after the last Evaluate
+        bool Active(const size_t index) const;
+
+        /*! Returns true if the robot's power off sequence must be
+          started.  Sent once while the rule is active and the power
+          is on, re-armed when the rule is released or the power is
+          seen off so power requested later is turned off again. */
+        static bool PowerOffRequired(const bool active, const bool powerEnabled,
+                                     bool & powerOffSent);
+
+    protected:
+        struct State {
+            Rule Definition;
+            bool Initialized;
+            bool Active;
+            bool PowerOffSent; // until the robot's power enable is seen off
+        };
+        std::vector<State> mRules;
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaReflexEngine1394_h
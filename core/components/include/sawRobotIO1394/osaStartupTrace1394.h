@@ -0,0 +1,95 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaStartupTrace1394_h
+#define _osaStartupTrace1394_h
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sawRobotIO1394/sawRobotIO1394Export.h>
+
+namespace sawRobotIO1394 {
+
+    /*! Opt-in trace of the startup phases (port creation, parsing,
+      interfaces, board queries...) saved using the Chrome trace
+      event format, i.e. can be loaded in chrome://tracing or
+      https://ui.perfetto.dev.  Phases are recorded as complete
+      events using Scope.  When disabled (default), Scope doesn't
+      read the time nor record anything.  Thread safe since Configure
+      and Startup don't always run in the same thread. */
+    class CISST_EXPORT osaStartupTrace1394 {
+    public:
+        osaStartupTrace1394(void);
+
+        /*! Output file, empty to disable.  Time origin is the
+          construction of the trace, phases are only recorded once a
+          file is set. */
+        void SetFilename(const std::string & filename);
+        inline const std::string & Filename(void) const {
+            return mFilename;
+        }
+        inline bool Enabled(void) const {
+            return !mFilename.empty();
+        }
+
+        /*! Add a complete event, times in seconds (see osaGetTime) */
+        void Add(const std::string & name, const char * category,
+                 const double startTime, const double endTime);
+
+        /*! Write all events recorded so far, returns false if the file
+          can't be written */
+        bool Save(void) const;
+        void ToStream(std::ostream & output) const;
+
+        /*! Record the time between construction and destruction or
+          End, whichever comes first */
+        class CISST_EXPORT Scope {
+        public:
+            Scope(osaStartupTrace1394 & trace, const std::string & name,
+                  const char * category = "startup");
+            ~Scope();
+            void End(void);
+        private:
+            osaStartupTrace1394 * mTrace; // null if disabled
+            std::string mName;
+            const char * mCategory;
+            double mStartTime;
+        };
+
+    protected:
+        struct Event {
+            std::string Name;
+            const char * Category;
+            double StartTime, Duration;
+            size_t ThreadIndex;
+        };
+
+        std::string mFilename;
+        double mOrigin;
+        mutable std::mutex mMutex;
+        std::vector<Event> mEvents;
+        std::map<std::thread::id, size_t> mThreadIndices; // small integers are easier to read than thread ids
+    };
+
+} // namespace sawRobotIO1394
+
+#endif // _osaStartupTrace1394_h
@@ -42,6 +42,16 @@ namespace sawRobotIO1394 {
                                               osaPort1394Configuration & config,
                                               const bool & calibrationMode);
 
+    /*! Same as osaXML1394ConfigurePort but returns false on error
+      instead of exiting.  In tolerant mode, parsing doesn't stop at
+      the first error and elements with errors are kept in the
+      configuration so they can be validated (see
+      osaConfigurationValidator1394Check), the result is still false. */
+    bool CISST_EXPORT osaXML1394LoadPort(const std::string & filename,
+                                         osaPort1394Configuration & config,
+                                         const bool & calibrationMode,
+                                         const bool & tolerant = false);
+
     bool CISST_EXPORT osaXML1394ConfigureRobot(cmnXMLPath & xmlConfig,
                                                const int robotIndex,
                                                osaRobot1394Configuration & robot,
@@ -70,6 +80,15 @@ namespace sawRobotIO1394 {
                                                     const int dallasIndex,
                                                     osaDallasChip1394Configuration & dallasChip);
 
+    bool CISST_EXPORT osaXML1394ConfigureReflex(cmnXMLPath & xmlConfig,
+                                                const int reflexIndex,
+                                                osaReflex1394Configuration & reflex);
+
+    /*! FIR coefficients are a space separated list in attribute FIR */
+    bool CISST_EXPORT osaXML1394ConfigureAnalogInput(cmnXMLPath & xmlConfig,
+                                                     const int analogIndex,
+                                                     osaAnalogInput1394Configuration & analogInput);
+
 } // namespace sawRobotIO1394
 
 #endif // _osaXML1394_h
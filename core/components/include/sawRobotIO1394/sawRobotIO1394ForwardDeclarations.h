@@ -29,7 +29,9 @@ namespace sawRobotIO1394 {
     class mtsRobot1394;
     class mtsDigitalInput1394;
     class mtsDigitalOutput1394;
+    class mtsAnalogInput1394;
     class mtsDallasChip1394;
+    class mtsMessageQueue1394;
 
     const double WatchdogTimeout = 30.0 * cmn_ms;
 
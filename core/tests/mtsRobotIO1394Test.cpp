@@ -18,8 +18,13 @@ http://www.cisst.org/cisst/license.txt.
 --- end cisst license ---
 */
 
+#include <cstdio>
+#include <fstream>
+
 #include "mtsRobotIO1394Test.h"
 #include <sawRobotIO1394/mtsRobotIO1394.h>
+#include <sawRobotIO1394/mtsRobot1394.h>
+#include <sawRobotIO1394/mtsDigitalOutput1394.h>
 #include <cisstVector/vctDynamicVectorTypes.h>
 
 void mtsRobotIO1394Test::TestCreate(void) {
@@ -27,6 +32,44 @@ void mtsRobotIO1394Test::TestCreate(void) {
     CPPUNIT_ASSERT(robot);
 }
 
+void mtsRobotIO1394Test::TestConfigureTwice(void) {
+    // two files with digital inputs only, no board query needed
+    const std::string files[2] = {"mtsRobotIO1394TestClutch.json",
+                                  "mtsRobotIO1394TestCoag.json"};
+    const std::string names[2] = {"Clutch", "Coag"};
+    for (size_t index = 0; index < 2; ++index) {
+        std::ofstream file(files[index]);
+        file << "{\"DigitalInputs\": [{\"Name\": \"" << names[index] << "\","
+             << " \"BoardID\": " << index << ", \"BitID\": 0,"
+             << " \"TriggerWhenPressed\": true, \"TriggerWhenReleased\": true,"
+             << " \"PressedValue\": false, \"SkipFirstRun\": false,"
+             << " \"DebounceThreshold\": 0.0, \"DebounceThresholdClick\": 0.0}]}"
+             << std::endl;
+    }
+
+    mtsRobotIO1394 * io = new mtsRobotIO1394("io", 1.0 * cmn_ms, "fw:0");
+    io->Configure(files[0]);
+    io->Configure(files[1]);
+    size_t numberOfInputs = 0;
+    io->GetNumberOfDigitalInputs(numberOfInputs);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), numberOfInputs);
+
+    // robots register with the message queue, must work after Configure
+    std::string xml_path = cmn_path.Find("sawRobotIO1394TestBoard.xml");
+    CPPUNIT_ASSERT(xml_path.length() > 0);
+    sawRobotIO1394::osaPort1394Configuration config;
+    CPPUNIT_ASSERT(io->LoadConfiguration(xml_path, config));
+    CPPUNIT_ASSERT(!config.Robots.empty());
+    sawRobotIO1394::mtsRobot1394 * robot = new sawRobotIO1394::mtsRobot1394(*io, config.Robots.at(0), false);
+    CPPUNIT_ASSERT_NO_THROW(CPPUNIT_ASSERT(io->SetupRobot(robot)));
+    io->AddRobot(robot);
+
+    delete io;
+    for (const auto & file : files) {
+        std::remove(file.c_str());
+    }
+}
+
 /*
 void mtsRobotIO1394Test::TestConfigure(void) {
     std::stringstream errorStream;
@@ -109,3 +152,63 @@ void mtsRobotIO1394::RobotInternal::AnalogInBitsToPosSI(const vctLongVec &fromDa
     AnalogInVoltsToPosSI(tempData,toData);
 }
 */
+
+void mtsRobotIO1394Test::TestDigitalOutputTrigger(void) {
+    mtsRobotIO1394 * io = new mtsRobotIO1394("io", 1.0 * cmn_ms, "fw:0");
+    sawRobotIO1394::osaDigitalOutput1394Configuration config;
+    config.Name = "Trigger";
+    config.BoardID = 0;
+    config.BitID = 1;
+    config.IsPWM = false;
+    config.TriggerPeriod = 1;
+    const uint32_t mask = 0x2;
+
+    sawRobotIO1394::osaDigitalOutputBatch1394 batch;
+    sawRobotIO1394::osaBoardSnapshot1394 snapshot;
+    sawRobotIO1394::mtsDigitalOutput1394 output(*io, config);
+    output.SetBatch(&batch);
+    output.SetBoardSnapshot(&snapshot);
+
+    // period 1, toggles every cycle starting high
+    output.StepTrigger();
+    CPPUNIT_ASSERT_EQUAL(mask, batch.SetMask);
+    batch.Clear();
+    output.StepTrigger();
+    CPPUNIT_ASSERT_EQUAL(mask, batch.ClearMask);
+    batch.Clear();
+
+    // period N, toggles every N cycles
+    config.TriggerPeriod = 3;
+    output.Configure(config);
+    for (size_t toggle = 0; toggle < 2; ++toggle) {
+        output.StepTrigger();
+        output.StepTrigger();
+        CPPUNIT_ASSERT(!batch.Pending());
+        output.StepTrigger();
+        CPPUNIT_ASSERT_EQUAL((toggle == 0) ? mask : 0u, batch.SetMask);
+        CPPUNIT_ASSERT_EQUAL((toggle == 0) ? 0u : mask, batch.ClearMask);
+        batch.Clear();
+    }
+
+    // restarted by Configure, cycles counted from 0 and starts high
+    output.StepTrigger();
+    output.StepTrigger();
+    output.Configure(config);
+    output.StepTrigger();
+    output.StepTrigger();
+    CPPUNIT_ASSERT(!batch.Pending());
+    output.StepTrigger();
+    CPPUNIT_ASSERT_EQUAL(mask, batch.SetMask);
+    batch.Clear();
+
+    // ignored for PWM outputs
+    config.IsPWM = true;
+    config.TriggerPeriod = 1;
+    output.Configure(config);
+    for (size_t cycle = 0; cycle < 4; ++cycle) {
+        output.StepTrigger();
+        CPPUNIT_ASSERT(!batch.Pending());
+    }
+
+    delete io;
+}
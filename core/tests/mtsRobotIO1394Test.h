@@ -37,6 +37,8 @@ protected:
     CPPUNIT_TEST_SUITE(mtsRobotIO1394Test);
     {
         CPPUNIT_TEST(TestCreate);
+        CPPUNIT_TEST(TestConfigureTwice);
+        CPPUNIT_TEST(TestDigitalOutputTrigger);
     }
     CPPUNIT_TEST_SUITE_END();
 
@@ -51,6 +53,14 @@ public:
 
     /*! Test constructor */
     void TestCreate(void);
+
+    /*! One configuration file per call, robots can still be added
+      after the first file */
+    void TestConfigureTwice(void);
+
+    /*! Output toggled every TriggerPeriod cycles, ignored for PWM
+      outputs and restarted by Configure */
+    void TestDigitalOutputTrigger(void);
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(mtsRobotIO1394Test);
@@ -0,0 +1,127 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sawRobotIO1394/osaAnalogFilter1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaAnalogFilter1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaAnalogFilter1394Test);
+    {
+        CPPUNIT_TEST(TestInvalid);
+        CPPUNIT_TEST(TestFIR);
+        CPPUNIT_TEST(TestIIR);
+        CPPUNIT_TEST(TestDecimationAndWindow);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    osaAnalogFilter1394 mFilter;
+    std::string mMessage;
+
+public:
+    void TestInvalid(void);
+    void TestFIR(void);
+    void TestIIR(void);
+    void TestDecimationAndWindow(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaAnalogFilter1394Test);
+
+void osaAnalogFilter1394Test::TestInvalid(void)
+{
+    const std::vector<double> none;
+    CPPUNIT_ASSERT(!mFilter.Configure(none, 0.0, 1, 0, mMessage));
+    CPPUNIT_ASSERT(!mFilter.Configure(none, 1.5, 1, 0, mMessage));
+    CPPUNIT_ASSERT(!mFilter.Configure(none, 1.0, 0, 0, mMessage));
+    CPPUNIT_ASSERT(!mFilter.Configure(none, 1.0, 1, -1, mMessage));
+    CPPUNIT_ASSERT(mFilter.Configure(none, 1.0, 1, 0, mMessage));
+
+    // no filtering, all samples published
+    CPPUNIT_ASSERT(mFilter.Step(3.0));
+    CPPUNIT_ASSERT_EQUAL(3.0, mFilter.Value());
+    CPPUNIT_ASSERT(!mFilter.WindowCompleted());
+}
+
+void osaAnalogFilter1394Test::TestFIR(void)
+{
+    // moving average over 2 samples, history starts with first sample
+    CPPUNIT_ASSERT(mFilter.Configure({0.5, 0.5}, 1.0, 1, 0, mMessage));
+    CPPUNIT_ASSERT(mFilter.Step(2.0));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, mFilter.Value(), 1e-12);
+    mFilter.Step(4.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, mFilter.Value(), 1e-12);
+    mFilter.Step(8.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(6.0, mFilter.Value(), 1e-12);
+
+    // asymmetric taps, first coefficient applies to latest sample
+    CPPUNIT_ASSERT(mFilter.Configure({1.0, 0.0, 0.0}, 1.0, 1, 0, mMessage));
+    mFilter.Step(1.0);
+    mFilter.Step(2.0);
+    mFilter.Step(5.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0, mFilter.Value(), 1e-12);
+    CPPUNIT_ASSERT(mFilter.Configure({0.0, 0.0, 1.0}, 1.0, 1, 0, mMessage));
+    mFilter.Step(1.0);
+    mFilter.Step(2.0);
+    mFilter.Step(5.0);
+    mFilter.Step(7.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, mFilter.Value(), 1e-12);
+}
+
+void osaAnalogFilter1394Test::TestIIR(void)
+{
+    CPPUNIT_ASSERT(mFilter.Configure({}, 0.5, 1, 0, mMessage));
+    mFilter.Step(4.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(4.0, mFilter.Value(), 1e-12);
+    mFilter.Step(0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, mFilter.Value(), 1e-12);
+    mFilter.Step(0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, mFilter.Value(), 1e-12);
+
+    // reset restarts from the next sample
+    mFilter.Reset();
+    mFilter.Step(10.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(10.0, mFilter.Value(), 1e-12);
+}
+
+void osaAnalogFilter1394Test::TestDecimationAndWindow(void)
+{
+    CPPUNIT_ASSERT(mFilter.Configure({}, 1.0, 3, 4, mMessage));
+    const double samples[] = {1.0, 5.0, 3.0, 2.0, 4.0, 6.0, 0.0, 1.0};
+    bool published[8];
+    bool windows[8];
+    for (size_t index = 0; index < 8; ++index) {
+        published[index] = mFilter.Step(samples[index]);
+        windows[index] = mFilter.WindowCompleted();
+    }
+    // published every third sample
+    CPPUNIT_ASSERT(!published[0] && !published[1] && published[2]);
+    CPPUNIT_ASSERT(!published[3] && !published[4] && published[5]);
+    CPPUNIT_ASSERT(!published[6] && !published[7]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(6.0, mFilter.Value(), 1e-12);
+
+    // windows completed every fourth sample, last one is {4, 6, 0, 1}
+    CPPUNIT_ASSERT(windows[3] && windows[7]);
+    CPPUNIT_ASSERT(!windows[0] && !windows[4] && !windows[6]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, mFilter.Minimum(), 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(6.0, mFilter.Maximum(), 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.75, mFilter.Mean(), 1e-12);
+}
@@ -0,0 +1,172 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sawRobotIO1394/osaConfigurationDiff1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaConfigurationDiff1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaConfigurationDiff1394Test);
+    {
+        CPPUNIT_TEST(TestNoChange);
+        CPPUNIT_TEST(TestCalibrationAndDigitalInputs);
+        CPPUNIT_TEST(TestRestartRequired);
+        CPPUNIT_TEST(TestDigitalInputAdded);
+        CPPUNIT_TEST(TestReflexes);
+        CPPUNIT_TEST(TestAnalogInputs);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    osaPort1394Configuration mCurrent;
+
+public:
+    void setUp(void) {
+        osaRobot1394Configuration robot;
+        robot.Name = "MTML";
+        robot.HardwareVersion = osa1394::QLA1;
+        robot.NumberOfActuators = 2;
+        robot.Actuators.resize(2);
+        robot.PotTolerances.resize(2);
+        for (size_t index = 0; index < 2; ++index) {
+            robot.Actuators.at(index).BoardID = 0;
+            robot.Actuators.at(index).AxisID = static_cast<int>(index);
+            robot.Actuators.at(index).Brake = nullptr;
+            robot.Actuators.at(index).Drive.CurrentToBits.Offset = 32768.0;
+        }
+        mCurrent.Robots.push_back(robot);
+
+        osaDigitalInput1394Configuration input;
+        input.Name = "Clutch";
+        input.BoardID = 0;
+        input.BitID = 1;
+        input.DebounceThreshold = 0.2;
+        mCurrent.DigitalInputs.push_back(input);
+    }
+
+    void tearDown(void) {
+        mCurrent = osaPort1394Configuration();
+    }
+
+    void TestNoChange(void);
+    void TestCalibrationAndDigitalInputs(void);
+    void TestRestartRequired(void);
+    void TestDigitalInputAdded(void);
+    void TestReflexes(void);
+    void TestAnalogInputs(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaConfigurationDiff1394Test);
+
+void osaConfigurationDiff1394Test::TestNoChange(void)
+{
+    osaConfigurationDiff1394 diff;
+    osaConfigurationDiff1394Compute(mCurrent, mCurrent, diff);
+    CPPUNIT_ASSERT(diff.Empty());
+    CPPUNIT_ASSERT(!diff.RequiresRestart());
+}
+
+void osaConfigurationDiff1394Test::TestCalibrationAndDigitalInputs(void)
+{
+    osaPort1394Configuration next = mCurrent;
+    next.Robots.at(0).Actuators.at(1).Drive.CurrentToBits.Offset = 32700.0;
+    next.DigitalInputs.at(0).DebounceThreshold = 0.1;
+
+    osaConfigurationDiff1394 diff;
+    osaConfigurationDiff1394Compute(mCurrent, next, diff);
+    CPPUNIT_ASSERT(!diff.Empty());
+    CPPUNIT_ASSERT(!diff.RequiresRestart());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), diff.RobotsCalibrationChanged.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), diff.DigitalInputsChanged.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), diff.DigitalInputsChanged.at(0));
+    CPPUNIT_ASSERT(diff.DigitalInputsAdded.empty());
+}
+
+void osaConfigurationDiff1394Test::TestRestartRequired(void)
+{
+    osaPort1394Configuration next = mCurrent;
+    next.Robots.at(0).Actuators.at(1).AxisID = 3;
+    next.DigitalInputs.clear();
+
+    osaConfigurationDiff1394 diff;
+    osaConfigurationDiff1394Compute(mCurrent, next, diff);
+    CPPUNIT_ASSERT(diff.RequiresRestart());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), diff.RobotsLayoutChanged.size());
+    CPPUNIT_ASSERT(diff.RobotsCalibrationChanged.empty());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), diff.DigitalInputsRemoved.size());
+}
+
+void osaConfigurationDiff1394Test::TestDigitalInputAdded(void)
+{
+    osaPort1394Configuration next = mCurrent;
+    osaDigitalInput1394Configuration input = next.DigitalInputs.at(0);
+    input.Name = "Coag";
+    input.BitID = 2;
+    next.DigitalInputs.push_back(input);
+
+    osaConfigurationDiff1394 diff;
+    osaConfigurationDiff1394Compute(mCurrent, next, diff);
+    CPPUNIT_ASSERT(!diff.Empty());
+    CPPUNIT_ASSERT(diff.RequiresRestart());
+    CPPUNIT_ASSERT(diff.DigitalInputsChanged.empty());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), diff.DigitalInputsAdded.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), diff.DigitalInputsAdded.at(0));
+}
+
+void osaConfigurationDiff1394Test::TestReflexes(void)
+{
+    osaPort1394Configuration next = mCurrent;
+    osaReflex1394Configuration reflex;
+    reflex.Input = "Clutch";
+    reflex.PowerOff = "MTML";
+    next.Reflexes.push_back(reflex);
+
+    osaConfigurationDiff1394 diff;
+    osaConfigurationDiff1394Compute(mCurrent, next, diff);
+    CPPUNIT_ASSERT(diff.ReflexesChanged);
+    CPPUNIT_ASSERT(diff.RequiresRestart());
+
+    osaConfigurationDiff1394Compute(next, next, diff);
+    CPPUNIT_ASSERT(diff.Empty());
+}
+
+void osaConfigurationDiff1394Test::TestAnalogInputs(void)
+{
+    osaPort1394Configuration next = mCurrent;
+    osaAnalogInput1394Configuration analogInput;
+    analogInput.Name = "Pressure";
+    analogInput.BoardID = 0;
+    analogInput.AxisID = 3;
+    next.AnalogInputs.push_back(analogInput);
+
+    osaConfigurationDiff1394 diff;
+    osaConfigurationDiff1394Compute(mCurrent, next, diff);
+    CPPUNIT_ASSERT(diff.AnalogInputsChanged);
+    CPPUNIT_ASSERT(diff.RequiresRestart());
+
+    osaPort1394Configuration filtered = next;
+    filtered.AnalogInputs.at(0).Decimation = 10;
+    osaConfigurationDiff1394Compute(next, filtered, diff);
+    CPPUNIT_ASSERT(diff.AnalogInputsChanged);
+
+    osaConfigurationDiff1394Compute(next, next, diff);
+    CPPUNIT_ASSERT(diff.Empty());
+}
@@ -0,0 +1,218 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <sawRobotIO1394/osaConfigurationValidator1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaConfigurationValidator1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaConfigurationValidator1394Test);
+    {
+        CPPUNIT_TEST(TestValid);
+        CPPUNIT_TEST(TestAllIssuesReported);
+        CPPUNIT_TEST(TestAnalogInputAxes);
+        CPPUNIT_TEST(TestXMLFile);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    osaPort1394Configuration mConfig;
+    std::string mContent;
+
+public:
+    void setUp(void) {
+        // 3 revolute actuators with calibrated offsets
+        osaRobot1394Configuration robot;
+        robot.Name = "PSM1";
+        robot.HardwareVersion = osa1394::QLA1;
+        robot.NumberOfActuators = 3;
+        robot.OnlyIO = false;
+        robot.Actuators.resize(3);
+        robot.PotTolerances.resize(3);
+        for (size_t index = 0; index < 3; ++index) {
+            osaActuator1394Configuration & actuator = robot.Actuators.at(index);
+            actuator.BoardID = 0;
+            actuator.AxisID = static_cast<int>(index);
+            actuator.JointType = CMN_JOINT_REVOLUTE;
+            actuator.Brake = nullptr;
+            actuator.Drive.EffortToCurrent.Scale = 1.0;
+            actuator.Drive.CurrentToBits.Offset = 32768.0 + index;
+            actuator.Encoder.BitsToPosition.Unit = "deg";
+            actuator.Encoder.PositionLimitsSoft.Unit = "deg";
+            actuator.Pot.Type = 1;
+            actuator.Pot.SensorToPosition.Unit = "deg";
+            osaPotTolerance1394Configuration & tolerance = robot.PotTolerances.at(index);
+            tolerance.AxisID = static_cast<int>(index);
+            tolerance.Distance = 0.1;
+            tolerance.Latency = 0.01;
+            tolerance.WindowSamples = 1;
+        }
+        mConfig.Robots.push_back(robot);
+
+        mContent =
+            "<Config Version=\"5\">\n"
+            "  <Robot Name=\"PSM1\" NumOfActuator=\"3\">\n"
+            "    <Actuator ActuatorID=\"0\" BoardID=\"0\" AxisID=\"0\">\n"
+            "    </Actuator>\n"
+            "    <Actuator ActuatorID=\"1\" BoardID=\"0\" AxisID=\"1\">\n"
+            "    </Actuator>\n"
+            "    <Actuator ActuatorID=\"2\" BoardID=\"0\" AxisID=\"2\">\n"
+            "    </Actuator>\n"
+            "  </Robot>\n"
+            "</Config>\n";
+    }
+
+    void tearDown(void) {
+        mConfig.Robots.clear();
+        mConfig.AnalogInputs.clear();
+    }
+
+    void TestValid(void);
+    void TestAllIssuesReported(void);
+    void TestAnalogInputAxes(void);
+    void TestXMLFile(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaConfigurationValidator1394Test);
+
+void osaConfigurationValidator1394Test::TestValid(void)
+{
+    std::vector<osaConfigurationIssue1394> issues;
+    CPPUNIT_ASSERT(osaConfigurationValidator1394CheckPort(mConfig, "test.xml", mContent, issues));
+    CPPUNIT_ASSERT(issues.empty());
+}
+
+void osaConfigurationValidator1394Test::TestAllIssuesReported(void)
+{
+    osaRobot1394Configuration & robot = mConfig.Robots.at(0);
+    // wrong unit and duplicate axis on actuator 2
+    robot.Actuators.at(2).Encoder.BitsToPosition.Unit = "mm";
+    robot.Actuators.at(2).AxisID = 1;
+    // all offsets equal
+    for (auto & actuator : robot.Actuators) {
+        actuator.Drive.CurrentToBits.Offset = 32768.0;
+    }
+    // disabled safety check is only a warning
+    robot.PotTolerances.at(0).Distance = 0.0;
+
+    std::vector<osaConfigurationIssue1394> issues;
+    CPPUNIT_ASSERT(!osaConfigurationValidator1394CheckPort(mConfig, "test.xml", mContent, issues));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), issues.size());
+
+    size_t errors = 0;
+    for (const auto & issue : issues) {
+        CPPUNIT_ASSERT_EQUAL(std::string("test.xml"), issue.File);
+        if (issue.Severity == osaConfigurationIssue1394::ISSUE_ERROR) {
+            ++errors;
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), errors);
+
+    // actuator issues point to the actuator line, offsets to the robot line
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), issues.at(0).Line);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), issues.at(1).Line);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), issues.at(2).Line);
+}
+
+void osaConfigurationValidator1394Test::TestAnalogInputAxes(void)
+{
+    osaAnalogInput1394Configuration analogInput;
+    analogInput.Name = "Pressure";
+    analogInput.BoardID = 0;
+    analogInput.AxisID = 3;
+    mConfig.AnalogInputs.push_back(analogInput);
+
+    std::vector<osaConfigurationIssue1394> issues;
+    CPPUNIT_ASSERT(osaConfigurationValidator1394CheckPort(mConfig, "test.xml", mContent, issues));
+    CPPUNIT_ASSERT(issues.empty());
+
+    // axis past the last one and axis used for a pot
+    mConfig.AnalogInputs.at(0).AxisID = static_cast<int>(MAX_AXES);
+    analogInput.Name = "Force";
+    analogInput.AxisID = 1;
+    mConfig.AnalogInputs.push_back(analogInput);
+    CPPUNIT_ASSERT(!osaConfigurationValidator1394CheckPort(mConfig, "test.xml", mContent, issues));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), issues.size());
+
+    // same axis on another board is fine
+    issues.clear();
+    mConfig.AnalogInputs.at(0).AxisID = 3;
+    mConfig.AnalogInputs.at(1).BoardID = 1;
+    CPPUNIT_ASSERT(osaConfigurationValidator1394CheckPort(mConfig, "test.xml", mContent, issues));
+    CPPUNIT_ASSERT(issues.empty());
+}
+
+void osaConfigurationValidator1394Test::TestXMLFile(void)
+{
+    // wrong unit and duplicate axis on actuator 2, both must be
+    // reported even if the parser fails on the unit
+    const std::string filename = "osaConfigurationValidator1394Test.xml";
+    {
+        std::ofstream file(filename.c_str());
+        file << "<Config Version=\"5\">\n"
+             << "  <Robot Name=\"PSM1\" HardwareVersion=\"QLA1\" NumOfActuator=\"3\">\n";
+        for (size_t index = 0; index < 3; ++index) {
+            const size_t axis = (index == 2) ? 1 : index;
+            const std::string unit = (index == 2) ? "mm" : "deg";
+            file << "    <Actuator ActuatorID=\"" << index << "\" BoardID=\"0\" AxisID=\"" << axis << "\" Type=\"Revolute\">\n"
+                 << "      <Drive>\n"
+                 << "        <AmpsToBits Offset=\"" << 32768 + index << "\" Scale=\"-5242.88\"/>\n"
+                 << "        <BitsToFeedbackAmps Offset=\"6.25\" Scale=\"-0.000190738\"/>\n"
+                 << "        <NmToAmps Scale=\"0.404089\"/>\n"
+                 << "        <MaxCurrent Unit=\"A\" Value=\"1.0\"/>\n"
+                 << "      </Drive>\n"
+                 << "      <Encoder VelocitySource=\"FIRMWARE\">\n"
+                 << "        <BitsToPosSI Scale=\"0.01\" Unit=\"" << unit << "\"/>\n"
+                 << "        <PositionLimitsSoft Lower=\"-90\" Upper=\"90\" Unit=\"deg\"/>\n"
+                 << "      </Encoder>\n"
+                 << "    </Actuator>\n";
+        }
+        file << "    <Potentiometers>\n";
+        for (size_t index = 0; index < 3; ++index) {
+            file << "      <Tolerance Axis=\"" << index << "\" Distance=\"5\" Latency=\"0.01\" Unit=\"deg\"/>\n";
+        }
+        file << "    </Potentiometers>\n"
+             << "  </Robot>\n"
+             << "</Config>\n";
+    }
+
+    std::vector<osaConfigurationIssue1394> issues;
+    CPPUNIT_ASSERT(!osaConfigurationValidator1394Check(filename, issues));
+    std::remove(filename.c_str());
+
+    size_t unitLine = 0, axisLine = 0;
+    for (const auto & issue : issues) {
+        CPPUNIT_ASSERT_EQUAL(osaConfigurationIssue1394::ISSUE_ERROR, issue.Severity);
+        CPPUNIT_ASSERT_EQUAL(std::string("Robot[0] PSM1/Actuator[2]"), issue.Context);
+        if (issue.Message.find("unit") != std::string::npos) {
+            unitLine = issue.Line;
+        } else if (issue.Message.find("already used") != std::string::npos) {
+            axisLine = issue.Line;
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), issues.size());
+    // third actuator element
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(27), unitLine);
+    CPPUNIT_ASSERT_EQUAL(unitLine, axisLine);
+}
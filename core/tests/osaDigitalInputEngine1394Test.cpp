@@ -0,0 +1,166 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstCommon/cmnGenericObjectProxy.h>
+
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+#include <sawRobotIO1394/osaDigitalInputEngine1394.h>
+#include <sawRobotIO1394/mtsDigitalInput1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaDigitalInputEngine1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaDigitalInputEngine1394Test);
+    {
+        CPPUNIT_TEST(TestOnlyChangedBitsPolled);
+        CPPUNIT_TEST(TestDebounce);
+        CPPUNIT_TEST(TestReconfigureLayout);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    cmnDouble mOwner;
+    osaBoardSnapshot1394 mSnapshot;
+    osaDigitalInputEngine1394 mEngine;
+    mtsDigitalInput1394 * mClutch = nullptr;
+    mtsDigitalInput1394 * mCoag = nullptr;
+
+    // one IO cycle, returns number of inputs updated
+    size_t Cycle(void) {
+        mSnapshot.FPGATime += mSnapshot.TimestampSeconds;
+        mEngine.PollState();
+        mEngine.CheckState();
+        return mEngine.NumberOfInputsPolled();
+    }
+
+public:
+    void setUp(void) {
+        osaDigitalInput1394Configuration config;
+        config.BoardID = 0;
+        config.TriggerWhenPressed = true;
+        config.TriggerWhenReleased = true;
+        config.PressedValue = false; // pressed when bit is set
+        config.SkipFirstRun = false;
+        config.DebounceThreshold = 0.0;
+        config.DebounceThresholdClick = 0.0;
+
+        config.Name = "Clutch";
+        config.BitID = 0;
+        mClutch = new mtsDigitalInput1394(mOwner, config);
+        mClutch->SetBoardSnapshot(&mSnapshot);
+        mEngine.Add(mClutch);
+
+        config.Name = "Coag";
+        config.BitID = 3;
+        config.DebounceThreshold = 0.01;
+        config.DebounceThresholdClick = 0.01;
+        mCoag = new mtsDigitalInput1394(mOwner, config);
+        mCoag->SetBoardSnapshot(&mSnapshot);
+        mEngine.Add(mCoag);
+
+        mSnapshot.DigitalInput = 0;
+        mSnapshot.TimestampSeconds = 0.004;
+    }
+
+    void tearDown(void) {
+        mEngine.Clear();
+        delete mClutch;
+        delete mCoag;
+    }
+
+    void TestOnlyChangedBitsPolled(void);
+    void TestDebounce(void);
+    void TestReconfigureLayout(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaDigitalInputEngine1394Test);
+
+void osaDigitalInputEngine1394Test::TestOnlyChangedBitsPolled(void)
+{
+    // first run, then one more cycle to settle previous values
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), Cycle());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), Cycle());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Cycle());
+    CPPUNIT_ASSERT(!mClutch->Value());
+
+    // bit not used by any input
+    mSnapshot.DigitalInput = 0x4;
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Cycle());
+
+    // clutch pressed, updated twice
+    mSnapshot.DigitalInput = 0x5;
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), Cycle());
+    CPPUNIT_ASSERT(mClutch->Value());
+    CPPUNIT_ASSERT(!mClutch->PreviousValue());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), Cycle());
+    CPPUNIT_ASSERT(mClutch->PreviousValue());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Cycle());
+}
+
+void osaDigitalInputEngine1394Test::TestDebounce(void)
+{
+    Cycle();
+    Cycle();
+
+    // coag pressed, value changes once the threshold is reached
+    mSnapshot.DigitalInput = 0x8;
+    const double pressTime = mSnapshot.FPGATime + mSnapshot.TimestampSeconds;
+    size_t cycles = 0;
+    while (!mCoag->Value() && (cycles < 10)) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), Cycle());
+        ++cycles;
+    }
+    CPPUNIT_ASSERT(mCoag->Value());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), cycles);
+
+    // edge time is the first read, not the end of debounce
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(pressTime, mCoag->EdgeTime(), 1.0e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mSnapshot.FPGATime, mCoag->ConfirmedTime(), 1.0e-9);
+    CPPUNIT_ASSERT(mCoag->ConfirmedTime() > mCoag->EdgeTime());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), Cycle());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Cycle());
+}
+
+void osaDigitalInputEngine1394Test::TestReconfigureLayout(void)
+{
+    Cycle();
+    Cycle();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Cycle());
+
+    // clutch moved to bit 1, layout built before the input is reconfigured
+    osaDigitalInput1394Configuration config = mClutch->Configuration();
+    config.BitID = 1;
+    osaDigitalInputEngine1394 layout;
+    layout.Add(mClutch, &mSnapshot, 0x2);
+    layout.Add(mCoag);
+    mClutch->Reconfigure(config);
+    mEngine.Swap(layout);
+    CPPUNIT_ASSERT_EQUAL(std::string("Clutch"), mClutch->Name());
+
+    // both updated on first cycle, then only the new bit matters
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), Cycle());
+    Cycle();
+    mSnapshot.DigitalInput = 0x1;
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Cycle());
+    mSnapshot.DigitalInput = 0x2;
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), Cycle());
+    CPPUNIT_ASSERT(mClutch->Value());
+}
@@ -0,0 +1,176 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <future>
+#include <thread>
+
+#include <sawRobotIO1394/osaDigitalInputHistory1394.h>
+
+using namespace sawRobotIO1394;
+
+// holds the history mutex from another thread, like a query would
+class osaDigitalInputHistory1394Locker : public osaDigitalInputHistory1394
+{
+    std::promise<void> mRelease;
+    std::thread mThread;
+public:
+    void Lock(void) {
+        std::promise<void> locked;
+        mRelease = std::promise<void>();
+        mThread = std::thread([this, &locked] (std::future<void> release) {
+                std::lock_guard<std::mutex> lock(mMutex);
+                locked.set_value();
+                release.wait();
+            }, mRelease.get_future());
+        locked.get_future().wait();
+    }
+    void Unlock(void) {
+        mRelease.set_value();
+        mThread.join();
+    }
+};
+
+class osaDigitalInputHistory1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaDigitalInputHistory1394Test);
+    {
+        CPPUNIT_TEST(TestDisabled);
+        CPPUNIT_TEST(TestShortPulse);
+        CPPUNIT_TEST(TestOverwritten);
+        CPPUNIT_TEST(TestPendingWhileLocked);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    osaDigitalInputHistory1394Locker mHistory;
+    std::vector<double> mTimes;
+    std::vector<bool> mValues;
+    double mLastTime;
+
+public:
+    void TestDisabled(void);
+    void TestShortPulse(void);
+    void TestOverwritten(void);
+    void TestPendingWhileLocked(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaDigitalInputHistory1394Test);
+
+void osaDigitalInputHistory1394Test::TestDisabled(void)
+{
+    mHistory.Update(0.001, 0x1);
+    mHistory.Update(0.002, 0x0);
+    CPPUNIT_ASSERT(mHistory.Edges(0x1, 0.0, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT(mTimes.empty());
+}
+
+void osaDigitalInputHistory1394Test::TestShortPulse(void)
+{
+    mHistory.SetCapacity(8);
+    // bit 2 pulses for a single cycle, bit 0 toggles later
+    mHistory.Update(0.001, 0x0);
+    mHistory.Update(0.002, 0x0);
+    mHistory.Update(0.003, 0x4);
+    mHistory.Update(0.004, 0x0);
+    mHistory.Update(0.005, 0x1);
+    mHistory.Update(0.006, 0x1);
+
+    CPPUNIT_ASSERT(mHistory.Edges(0x4, 0.0, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), mTimes.size());
+    CPPUNIT_ASSERT_EQUAL(0.003, mTimes.at(0));
+    CPPUNIT_ASSERT(mValues.at(0));
+    CPPUNIT_ASSERT_EQUAL(0.004, mTimes.at(1));
+    CPPUNIT_ASSERT(!mValues.at(1));
+    CPPUNIT_ASSERT_EQUAL(0.006, mLastTime);
+
+    // since is exclusive
+    CPPUNIT_ASSERT(mHistory.Edges(0x4, 0.003, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), mTimes.size());
+    CPPUNIT_ASSERT_EQUAL(0.004, mTimes.at(0));
+
+    CPPUNIT_ASSERT(mHistory.Edges(0x1, 0.0, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), mTimes.size());
+    CPPUNIT_ASSERT_EQUAL(0.005, mTimes.at(0));
+}
+
+void osaDigitalInputHistory1394Test::TestOverwritten(void)
+{
+    mHistory.SetCapacity(3);
+    mHistory.Update(0.001, 0x0);
+    mHistory.Update(0.002, 0x1);
+    mHistory.Update(0.003, 0x0);
+    mHistory.Update(0.004, 0x1);
+
+    // word at 0.001 is gone, edge at 0.002 can't be found
+    CPPUNIT_ASSERT(!mHistory.Edges(0x1, 0.0, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), mTimes.size());
+    CPPUNIT_ASSERT_EQUAL(0.003, mTimes.at(0));
+    CPPUNIT_ASSERT_EQUAL(0.004, mTimes.at(1));
+
+    // anything after the oldest word kept is complete
+    CPPUNIT_ASSERT(mHistory.Edges(0x1, 0.002, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), mTimes.size());
+
+    mHistory.Clear();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), mHistory.Capacity());
+    CPPUNIT_ASSERT(mHistory.Edges(0x1, 0.0, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT(mTimes.empty());
+}
+
+void osaDigitalInputHistory1394Test::TestPendingWhileLocked(void)
+{
+    mHistory.SetCapacity(64);
+    mHistory.Update(0.001, 0x0);
+
+    // updates don't wait while a query holds the mutex
+    mHistory.Lock();
+    mHistory.Update(0.002, 0x1);
+    mHistory.Update(0.003, 0x0);
+    mHistory.Unlock();
+    CPPUNIT_ASSERT(mHistory.Edges(0x1, 0.0, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT(mTimes.empty());
+    CPPUNIT_ASSERT_EQUAL(0.001, mLastTime);
+
+    // added on next update
+    mHistory.Update(0.004, 0x0);
+    CPPUNIT_ASSERT(mHistory.Edges(0x1, 0.0, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), mTimes.size());
+    CPPUNIT_ASSERT_EQUAL(0.002, mTimes.at(0));
+    CPPUNIT_ASSERT_EQUAL(0.003, mTimes.at(1));
+    CPPUNIT_ASSERT_EQUAL(0.004, mLastTime);
+
+    // more changes than the pending buffer can keep, edges are lost but
+    // the history still ends with the last word
+    mHistory.Lock();
+    double time = 0.004;
+    uint32_t word = 0x0;
+    for (size_t index = 0; index <= osaDigitalInputHistory1394::PENDING_SIZE; ++index) {
+        time += 0.001;
+        word ^= 0x1;
+        mHistory.Update(time, word);
+    }
+    mHistory.Unlock();
+    mHistory.Update(time + 0.001, word);
+    CPPUNIT_ASSERT(!mHistory.Edges(0x1, 0.004, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT_EQUAL(word != 0, static_cast<bool>(mValues.back()));
+    CPPUNIT_ASSERT_EQUAL(time + 0.001, mLastTime);
+    CPPUNIT_ASSERT(mHistory.Edges(0x1, time, mTimes, mValues, mLastTime));
+    CPPUNIT_ASSERT(mTimes.empty());
+}
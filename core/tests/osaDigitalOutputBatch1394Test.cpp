@@ -0,0 +1,70 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sawRobotIO1394/osaDigitalOutputBatch1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaDigitalOutputBatch1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaDigitalOutputBatch1394Test);
+    {
+        CPPUNIT_TEST(TestMultipleOutputs);
+        CPPUNIT_TEST(TestLastRequestWins);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestMultipleOutputs(void);
+    void TestLastRequestWins(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaDigitalOutputBatch1394Test);
+
+void osaDigitalOutputBatch1394Test::TestMultipleOutputs(void)
+{
+    osaDigitalOutputBatch1394 batch;
+    CPPUNIT_ASSERT(!batch.Pending());
+
+    // two outputs changed in the same cycle, other bits untouched
+    batch.Request(0x1, true);
+    batch.Request(0x4, false);
+    CPPUNIT_ASSERT(batch.Pending());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0x1), batch.SetMask);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0x4), batch.ClearMask);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0xb), batch.Apply(0xe));
+
+    batch.Clear();
+    CPPUNIT_ASSERT(!batch.Pending());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0xe), batch.Apply(0xe));
+}
+
+void osaDigitalOutputBatch1394Test::TestLastRequestWins(void)
+{
+    osaDigitalOutputBatch1394 batch;
+    batch.Request(0x2, true);
+    batch.Request(0x2, false);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0x0), batch.SetMask);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0x2), batch.ClearMask);
+    batch.Request(0x2, true);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0x2), batch.SetMask);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0x0), batch.ClearMask);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(0x3), batch.Apply(0x1));
+}
@@ -0,0 +1,151 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sawRobotIO1394/osaDigitalOutputSequencer1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaDigitalOutputSequencer1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaDigitalOutputSequencer1394Test);
+    {
+        CPPUNIT_TEST(TestInvalid);
+        CPPUNIT_TEST(TestPlayOnce);
+        CPPUNIT_TEST(TestRepeatWithoutDrift);
+        CPPUNIT_TEST(TestShortDurations);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    osaDigitalOutputSequence1394 mSequence;
+    osaDigitalOutputSequencer1394 mSequencer;
+
+    // pulse, 3 ms high and 7 ms low
+    void SetPulse(const unsigned int repeat) {
+        mSequence.Durations.SetSize(2);
+        mSequence.Durations.at(0) = 0.003;
+        mSequence.Durations.at(1) = 0.007;
+        mSequence.Values.SetSize(2);
+        mSequence.Values.at(0) = 1.0;
+        mSequence.Values.at(1) = 0.0;
+        mSequence.Repeat = repeat;
+    }
+
+public:
+    void TestInvalid(void);
+    void TestPlayOnce(void);
+    void TestRepeatWithoutDrift(void);
+    void TestShortDurations(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaDigitalOutputSequencer1394Test);
+
+void osaDigitalOutputSequencer1394Test::TestInvalid(void)
+{
+    std::string message;
+    CPPUNIT_ASSERT(!mSequencer.Start(mSequence, message));
+    SetPulse(1);
+    mSequence.Values.SetSize(1);
+    CPPUNIT_ASSERT(!mSequencer.Start(mSequence, message));
+    SetPulse(1);
+    mSequence.Durations.at(1) = 0.0;
+    CPPUNIT_ASSERT(!mSequencer.Start(mSequence, message));
+    CPPUNIT_ASSERT(!mSequencer.Playing());
+}
+
+void osaDigitalOutputSequencer1394Test::TestPlayOnce(void)
+{
+    std::string message;
+    SetPulse(1);
+    CPPUNIT_ASSERT(mSequencer.Start(mSequence, message));
+
+    // first value right away, then changes on the first cycle past the step
+    double value = -1.0;
+    CPPUNIT_ASSERT(mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT_EQUAL(1.0, value);
+    CPPUNIT_ASSERT(!mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT(!mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT(mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT_EQUAL(0.0, value);
+
+    // stops after the last step
+    for (size_t cycle = 0; cycle < 6; ++cycle) {
+        CPPUNIT_ASSERT(!mSequencer.Step(0.001, value));
+        CPPUNIT_ASSERT(mSequencer.Playing());
+    }
+    CPPUNIT_ASSERT(!mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT(!mSequencer.Playing());
+}
+
+void osaDigitalOutputSequencer1394Test::TestRepeatWithoutDrift(void)
+{
+    std::string message;
+    SetPulse(0);
+    CPPUNIT_ASSERT(mSequencer.Start(mSequence, message));
+
+    // 0.75 ms cycles, count rising edges over 1 second
+    double value, previous = 0.0;
+    size_t risingEdges = 0;
+    for (size_t cycle = 0; cycle < 1333; ++cycle) {
+        if (mSequencer.Step(0.00075, value)) {
+            if ((value == 1.0) && (previous == 0.0)) {
+                ++risingEdges;
+            }
+            previous = value;
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(100), risingEdges);
+    CPPUNIT_ASSERT(mSequencer.Playing());
+    mSequencer.Stop();
+    CPPUNIT_ASSERT(!mSequencer.Step(0.00075, value));
+}
+
+void osaDigitalOutputSequencer1394Test::TestShortDurations(void)
+{
+    std::string message;
+    double value;
+
+    // durations much shorter than a cycle, repeated forever
+    SetPulse(0);
+    mSequence.Durations.SetAll(1.0e-12);
+    CPPUNIT_ASSERT(mSequencer.Start(mSequence, message));
+    CPPUNIT_ASSERT(mSequencer.Step(0.001, value));
+    for (size_t cycle = 0; cycle < 10; ++cycle) {
+        mSequencer.Step(0.001, value);
+        CPPUNIT_ASSERT(mSequencer.Playing());
+    }
+
+    // same with a limited number of repetitions, all done in one cycle
+    SetPulse(1000);
+    mSequence.Durations.SetAll(1.0e-12);
+    CPPUNIT_ASSERT(mSequencer.Start(mSequence, message));
+    CPPUNIT_ASSERT(mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT(!mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT(!mSequencer.Playing());
+
+    // long gap between two cycles, position in sequence is kept
+    SetPulse(0);
+    CPPUNIT_ASSERT(mSequencer.Start(mSequence, message));
+    CPPUNIT_ASSERT(mSequencer.Step(0.001, value));
+    CPPUNIT_ASSERT_EQUAL(1.0, value);
+    CPPUNIT_ASSERT(mSequencer.Step(10.0045, value));
+    CPPUNIT_ASSERT_EQUAL(0.0, value);
+    CPPUNIT_ASSERT(mSequencer.Playing());
+}
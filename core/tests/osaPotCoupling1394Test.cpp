@@ -0,0 +1,109 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstVector/vctDynamicVectorTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+
+#include <sawRobotIO1394/osaPotCoupling1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaPotCoupling1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaPotCoupling1394Test);
+    {
+        CPPUNIT_TEST(TestKernels);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Make sure each kernel gives the same result as the dense product */
+    void TestKernels(void);
+
+protected:
+    void CheckKernel(const vctDoubleMat & coupling,
+                     const osaPotCoupling1394::KernelType expected);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaPotCoupling1394Test);
+
+void osaPotCoupling1394Test::CheckKernel(const vctDoubleMat & coupling,
+                                         const osaPotCoupling1394::KernelType expected)
+{
+    osaPotCoupling1394 kernel;
+    kernel.Configure(coupling);
+    CPPUNIT_ASSERT_EQUAL(expected, kernel.Kernel());
+
+    vctDoubleVec input(coupling.cols());
+    for (size_t index = 0; index < input.size(); ++index) {
+        input.Element(index) = 0.5 * index - 1.0;
+    }
+    vctDoubleVec reference(coupling.rows());
+    reference.ProductOf(coupling, input);
+    vctDoubleVec output(coupling.rows(), 123.0);
+    kernel.Apply(input, output);
+    for (size_t index = 0; index < output.size(); ++index) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(reference.Element(index), output.Element(index), 1e-12);
+    }
+}
+
+void osaPotCoupling1394Test::TestKernels(void)
+{
+    // empty, no coupling
+    osaPotCoupling1394 none;
+    none.Configure(vctDoubleMat());
+    CPPUNIT_ASSERT_EQUAL(osaPotCoupling1394::NONE, none.Kernel());
+
+    // identity
+    vctDoubleMat coupling(7, 7, 0.0);
+    for (size_t index = 0; index < 7; ++index) {
+        coupling.Element(index, index) = 1.0;
+    }
+    CheckKernel(coupling, osaPotCoupling1394::IDENTITY);
+
+    // permutation
+    vctDoubleMat permutation(4, 4, 0.0);
+    permutation.Element(0, 2) = 1.0;
+    permutation.Element(1, 0) = 1.0;
+    permutation.Element(2, 3) = 1.0;
+    permutation.Element(3, 1) = 1.0;
+    CheckKernel(permutation, osaPotCoupling1394::PERMUTATION);
+
+    // MTM like, mostly identity with a few couplings
+    coupling.Element(2, 1) = -1.0;
+    coupling.Element(3, 1) = 0.6697;
+    coupling.Element(3, 2) = 0.6697;
+    CheckKernel(coupling, osaPotCoupling1394::SPARSE);
+
+    // full
+    vctDoubleMat dense(3, 3, 0.0);
+    for (size_t row = 0; row < 3; ++row) {
+        for (size_t col = 0; col < 3; ++col) {
+            dense.Element(row, col) = 1.0 + row - 2.0 * col;
+        }
+    }
+    CheckKernel(dense, osaPotCoupling1394::DENSE);
+}
@@ -0,0 +1,218 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sawRobotIO1394/osaPotEncoderCheck1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaPotEncoderCheck1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaPotEncoderCheck1394Test);
+    {
+        CPPUNIT_TEST(TestLatencyAndHysteresis);
+        CPPUNIT_TEST(TestWindow);
+        CPPUNIT_TEST(TestWindowNoDrift);
+        CPPUNIT_TEST(TestUpdateTolerances);
+        CPPUNIT_TEST(TestDisabledAtRuntime);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    void TestLatencyAndHysteresis(void);
+    void TestWindow(void);
+    void TestWindowNoDrift(void);
+    void TestUpdateTolerances(void);
+    void TestDisabledAtRuntime(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaPotEncoderCheck1394Test);
+
+void osaPotEncoderCheck1394Test::TestLatencyAndHysteresis(void)
+{
+    std::vector<osaPotTolerance1394Configuration> tolerances(2);
+    tolerances[0].Distance = 0.1;
+    tolerances[0].Latency = 0.0095;
+    tolerances[0].Hysteresis = 0.05;
+    tolerances[0].WindowSamples = 1;
+    // second actuator, check disabled
+    tolerances[1].Distance = 0.0;
+    tolerances[1].Latency = 0.0;
+    tolerances[1].Hysteresis = 0.0;
+    tolerances[1].WindowSamples = 1;
+
+    osaPotEncoderCheck1394 check;
+    check.Configure(tolerances);
+    const vctDoubleVec encoders(2, 0.0);
+    const vctDoubleVec elapsed(2, 0.001);
+    vctDoubleVec pots(2, 0.0);
+
+    // large error on both, only first one is checked, must last more than latency
+    pots.SetAll(0.2);
+    for (size_t cycle = 0; cycle < 9; ++cycle) {
+        CPPUNIT_ASSERT(!check.Check(pots, encoders, elapsed));
+        CPPUNIT_ASSERT(check.AllValid());
+    }
+    CPPUNIT_ASSERT(check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(!check.AllValid());
+    CPPUNIT_ASSERT(check.NewlyInvalid()[0]);
+    CPPUNIT_ASSERT(!check.NewlyInvalid()[1]);
+    CPPUNIT_ASSERT(check.Valid()[1]);
+
+    // not new anymore
+    CPPUNIT_ASSERT(!check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(!check.NewlyInvalid()[0]);
+
+    // below distance but within hysteresis, still invalid
+    pots.SetAll(0.08);
+    CPPUNIT_ASSERT(!check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(!check.AllValid());
+
+    // below distance - hysteresis
+    pots.SetAll(0.04);
+    CPPUNIT_ASSERT(check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(check.AllValid());
+}
+
+void osaPotEncoderCheck1394Test::TestWindow(void)
+{
+    std::vector<osaPotTolerance1394Configuration> tolerances(1);
+    tolerances[0].Distance = 0.1;
+    tolerances[0].Latency = 0.0;
+    tolerances[0].Hysteresis = 0.0;
+    tolerances[0].WindowSamples = 4;
+
+    osaPotEncoderCheck1394 check;
+    check.Configure(tolerances);
+    const vctDoubleVec elapsed(1, 0.001);
+    vctDoubleVec encoders(1, 0.0);
+    vctDoubleVec pots(1, 0.0);
+
+    // noisy pot, single spikes are filtered out
+    for (size_t cycle = 0; cycle < 100; ++cycle) {
+        encoders[0] = 0.01 * cycle; // arm is moving
+        pots[0] = encoders[0] + ((cycle % 4 == 0) ? 0.3 : -0.05);
+        check.Check(pots, encoders, elapsed);
+        CPPUNIT_ASSERT(check.AllValid());
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0375, check.Error()[0], 1e-9);
+
+    // constant offset, trips once window is filled
+    pots[0] = encoders[0] + 0.3;
+    for (size_t cycle = 0; cycle < 4; ++cycle) {
+        check.Check(pots, encoders, elapsed);
+    }
+    CPPUNIT_ASSERT(!check.AllValid());
+}
+
+void osaPotEncoderCheck1394Test::TestWindowNoDrift(void)
+{
+    std::vector<osaPotTolerance1394Configuration> tolerances(1);
+    tolerances[0].Distance = 1.0e9;
+    tolerances[0].Latency = 0.0;
+    tolerances[0].Hysteresis = 0.0;
+    tolerances[0].WindowSamples = 5;
+
+    osaPotEncoderCheck1394 check;
+    check.Configure(tolerances);
+    const vctDoubleVec elapsed(1, 0.001);
+    const vctDoubleVec encoders(1, 0.0);
+    vctDoubleVec pots(1, 0.0);
+
+    // large values with fractional parts, rounding errors in the running sum
+    for (size_t cycle = 0; cycle < 200000; ++cycle) {
+        pots[0] = 1.0e6 * ((cycle % 7) + 1) + 0.1 * (cycle % 3);
+        check.Check(pots, encoders, elapsed);
+    }
+    pots[0] = 0.01;
+    for (size_t cycle = 0; cycle < 5; ++cycle) {
+        check.Check(pots, encoders, elapsed);
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.01, check.Error()[0], 1e-9);
+}
+
+void osaPotEncoderCheck1394Test::TestUpdateTolerances(void)
+{
+    std::vector<osaPotTolerance1394Configuration> tolerances(1);
+    tolerances[0].Distance = 0.1;
+    tolerances[0].Latency = 0.0;
+    tolerances[0].Hysteresis = 0.0;
+    tolerances[0].WindowSamples = 2;
+
+    osaPotEncoderCheck1394 check;
+    check.Configure(tolerances);
+    const vctDoubleVec elapsed(1, 0.001);
+    const vctDoubleVec encoders(1, 0.0);
+    const vctDoubleVec pots(1, 0.2);
+    check.Check(pots, encoders, elapsed);
+    check.Check(pots, encoders, elapsed);
+    CPPUNIT_ASSERT(!check.AllValid());
+
+    // window size can't change
+    tolerances[0].WindowSamples = 3;
+    CPPUNIT_ASSERT(!check.UpdateTolerances(tolerances));
+
+    // larger distance, state is kept until next check
+    tolerances[0].WindowSamples = 2;
+    tolerances[0].Distance = 0.5;
+    CPPUNIT_ASSERT(check.UpdateTolerances(tolerances));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, check.Distance()[0], 1e-9);
+    CPPUNIT_ASSERT(!check.AllValid());
+    CPPUNIT_ASSERT(check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(check.AllValid());
+}
+
+void osaPotEncoderCheck1394Test::TestDisabledAtRuntime(void)
+{
+    std::vector<osaPotTolerance1394Configuration> tolerances(1);
+    tolerances[0].Distance = 0.1;
+    tolerances[0].Latency = 0.0;
+    tolerances[0].Hysteresis = 0.0;
+    tolerances[0].WindowSamples = 2;
+
+    osaPotEncoderCheck1394 check;
+    check.Configure(tolerances);
+    const vctDoubleVec elapsed(1, 0.001);
+    const vctDoubleVec encoders(1, 0.0);
+    const vctDoubleVec pots(1, 0.2);
+    check.Check(pots, encoders, elapsed);
+    check.Check(pots, encoders, elapsed);
+    CPPUNIT_ASSERT(!check.AllValid());
+
+    // tolerance set to 0, invalid state is not latched
+    tolerances[0].Distance = 0.0;
+    CPPUNIT_ASSERT(check.UpdateTolerances(tolerances));
+    CPPUNIT_ASSERT(check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(check.AllValid());
+    CPPUNIT_ASSERT(check.Valid()[0]);
+
+    // enabled again, waits for a new full window
+    tolerances[0].Distance = 0.1;
+    CPPUNIT_ASSERT(check.UpdateTolerances(tolerances));
+    CPPUNIT_ASSERT(!check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(check.AllValid());
+    CPPUNIT_ASSERT(check.Check(pots, encoders, elapsed));
+    CPPUNIT_ASSERT(!check.AllValid());
+}
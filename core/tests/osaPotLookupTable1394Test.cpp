@@ -0,0 +1,158 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <sawRobotIO1394/osaPotLookupTable1394.h>
+#include <sawRobotIO1394/mtsRobot1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaPotLookupTable1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaPotLookupTable1394Test);
+    {
+        CPPUNIT_TEST(TestMissingAndClamp);
+        CPPUNIT_TEST(TestInterpolation);
+        CPPUNIT_TEST(TestReadFile);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    void TestMissingAndClamp(void);
+    void TestInterpolation(void);
+    void TestReadFile(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaPotLookupTable1394Test);
+
+void osaPotLookupTable1394Test::TestMissingAndClamp(void)
+{
+    const double missing = mtsRobot1394::GetMissingPotValue();
+    vctDoubleVec table(5, 1.0);
+    table[2] = missing;
+
+    osaPotLookupTable1394 lookup;
+    lookup.SetSize(1, table.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lookup.SetTable(0, table));
+
+    vctIntVec raw(1);
+    vctDoubleVec positions(1);
+    raw[0] = 1;
+    lookup.Lookup(raw, positions);
+    CPPUNIT_ASSERT(!lookup.AnyMissing());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, positions[0], 1e-9);
+
+    raw[0] = 2;
+    lookup.Lookup(raw, positions);
+    CPPUNIT_ASSERT(lookup.AnyMissing());
+    CPPUNIT_ASSERT(lookup.Missing()[0]);
+
+    // out of range values are clamped and reported as missing
+    raw[0] = -1;
+    lookup.Lookup(raw, positions);
+    CPPUNIT_ASSERT(lookup.Missing()[0]);
+    raw[0] = 1000;
+    lookup.Lookup(raw, positions);
+    CPPUNIT_ASSERT(lookup.Missing()[0]);
+}
+
+void osaPotLookupTable1394Test::TestInterpolation(void)
+{
+    const double missing = mtsRobot1394::GetMissingPotValue();
+    vctDoubleVec table(70);
+    for (size_t index = 0; index < table.size(); ++index) {
+        table[index] = 0.1 * index;
+    }
+    table[0] = missing;
+    table[3] = missing;
+    table[4] = missing;
+    table[69] = missing;
+
+    osaPotLookupTable1394 lookup;
+    lookup.SetSize(1, table.size());
+    // gaps are filled, first and last entries remain missing
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lookup.SetTable(0, table, true));
+
+    vctIntVec raw(1);
+    vctDoubleVec positions(1);
+    raw[0] = 3;
+    lookup.Lookup(raw, positions);
+    CPPUNIT_ASSERT(!lookup.AnyMissing());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.3, positions[0], 1e-9);
+
+    // second bitmap word
+    raw[0] = 65;
+    lookup.Lookup(raw, positions);
+    CPPUNIT_ASSERT(!lookup.AnyMissing());
+    raw[0] = 69;
+    lookup.Lookup(raw, positions);
+    CPPUNIT_ASSERT(lookup.AnyMissing());
+}
+
+void osaPotLookupTable1394Test::TestReadFile(void)
+{
+    const std::string filename = "osaPotLookupTable1394Test.json";
+    std::vector<vctDoubleVec> rows(2);
+    std::vector<vctDoubleVec *> tables;
+    for (auto & row : rows) {
+        tables.push_back(&row);
+    }
+    std::string serial, errorMessage;
+
+    // unknown keys are skipped, serial can be a number
+    {
+        std::ofstream file(filename.c_str());
+        file << "{\n  \"comment\": {\"a\": [1, \"b\"], \"c\": null},\n"
+             << "  \"serial\": 12345,\n"
+             << "  \"lookup\": [[0.5, -1.25e-3, 31.4159],\n"
+             << "             [2, 3]]\n}\n";
+    }
+    CPPUNIT_ASSERT(osaPotLookupTable1394ReadFile(filename, serial, tables, errorMessage));
+    CPPUNIT_ASSERT_EQUAL(std::string("12345"), serial);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), rows[0].size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), rows[1].size());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.25e-3, rows[0][1], 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, rows[1][1], 1e-12);
+
+    // wrong number of rows
+    {
+        std::ofstream file(filename.c_str());
+        file << "{\"serial\": \"12345\", \"lookup\": [[1.0]]}";
+    }
+    CPPUNIT_ASSERT(!osaPotLookupTable1394ReadFile(filename, serial, tables, errorMessage));
+
+    // syntax error, line is reported
+    {
+        std::ofstream file(filename.c_str());
+        file << "{\"serial\": \"12345\",\n\"lookup\": [[1.0, x], [2.0]]}";
+    }
+    CPPUNIT_ASSERT(!osaPotLookupTable1394ReadFile(filename, serial, tables, errorMessage));
+    CPPUNIT_ASSERT(errorMessage.find("line 2") != std::string::npos);
+
+    std::remove(filename.c_str());
+}
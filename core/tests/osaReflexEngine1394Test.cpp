@@ -0,0 +1,214 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstCommon/cmnGenericObjectProxy.h>
+
+#include <sawRobotIO1394/osaBoardSnapshot1394.h>
+#include <sawRobotIO1394/osaDigitalOutputBatch1394.h>
+#include <sawRobotIO1394/osaJSON1394.h>
+#include <sawRobotIO1394/osaReflexEngine1394.h>
+#include <sawRobotIO1394/mtsDigitalInput1394.h>
+#include <sawRobotIO1394/mtsDigitalOutput1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaReflexEngine1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaReflexEngine1394Test);
+    {
+        CPPUNIT_TEST(TestActivationAndRelease);
+        CPPUNIT_TEST(TestWhenReleased);
+        CPPUNIT_TEST(TestPowerOffRearm);
+        CPPUNIT_TEST(TestJSONDefaults);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    cmnDouble mOwner;
+    osaBoardSnapshot1394 mSnapshot;
+    osaDigitalOutputBatch1394 mBatch;
+    osaReflexEngine1394 mEngine;
+    mtsDigitalInput1394 * mInput = nullptr;
+    mtsDigitalOutput1394 * mOutput = nullptr;
+    const uint32_t mOutputMask = 0x4;
+
+    // one IO cycle, input pressed or not, client command in between
+    void Cycle(const bool pressed) {
+        mBatch.Clear();
+        mSnapshot.DigitalInput = pressed ? 0x1 : 0x0;
+        mSnapshot.FPGATime += mSnapshot.TimestampSeconds;
+        mInput->PollState();
+        mInput->CheckState();
+        mEngine.Evaluate();
+    }
+
+    void Write(void) {
+        mOutput->StepSequence();
+        mOutput->StepTrigger();
+        mOutput->StepHold();
+    }
+
+public:
+    void setUp(void) {
+        osaDigitalInput1394Configuration inputConfig;
+        inputConfig.Name = "Clutch";
+        inputConfig.BoardID = 0;
+        inputConfig.BitID = 0;
+        inputConfig.TriggerWhenPressed = false;
+        inputConfig.TriggerWhenReleased = false;
+        inputConfig.PressedValue = false; // pressed when bit is set
+        inputConfig.SkipFirstRun = false;
+        inputConfig.DebounceThreshold = 0.0;
+        inputConfig.DebounceThresholdClick = 0.0;
+        mInput = new mtsDigitalInput1394(mOwner, inputConfig);
+        mInput->SetBoardSnapshot(&mSnapshot);
+
+        osaDigitalOutput1394Configuration outputConfig;
+        outputConfig.Name = "Light";
+        outputConfig.BoardID = 0;
+        outputConfig.BitID = 2;
+        outputConfig.IsPWM = false;
+        outputConfig.TriggerPeriod = 0;
+        mOutput = new mtsDigitalOutput1394(mOwner, outputConfig);
+        mOutput->SetBatch(&mBatch);
+        mOutput->SetBoardSnapshot(&mSnapshot);
+
+        mSnapshot.DigitalInput = 0;
+        mSnapshot.TimestampSeconds = 0.001;
+    }
+
+    void tearDown(void) {
+        mEngine.Clear();
+        delete mInput;
+        delete mOutput;
+    }
+
+    void TestActivationAndRelease(void);
+    void TestWhenReleased(void);
+    void TestPowerOffRearm(void);
+    void TestJSONDefaults(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaReflexEngine1394Test);
+
+void osaReflexEngine1394Test::TestActivationAndRelease(void)
+{
+    osaReflexEngine1394::Rule rule;
+    rule.Input = mInput;
+    rule.Output = mOutput;
+    rule.OutputValue = true;
+    mEngine.Add(rule);
+
+    // first cycle, rule inactive and output released with inactive value
+    Cycle(false);
+    CPPUNIT_ASSERT(!mEngine.Active(0));
+    CPPUNIT_ASSERT(!mOutput->Held());
+    CPPUNIT_ASSERT_EQUAL(mOutputMask, mBatch.ClearMask);
+
+    // nothing written while the state doesn't change
+    Cycle(false);
+    CPPUNIT_ASSERT(!mBatch.Pending());
+
+    // pressed, output held even if a client sets it between PostRead and Write
+    Cycle(true);
+    CPPUNIT_ASSERT(mEngine.Active(0));
+    CPPUNIT_ASSERT(mOutput->Held());
+    mOutput->SetValue(false);
+    Write();
+    CPPUNIT_ASSERT_EQUAL(mOutputMask, mBatch.SetMask);
+    Cycle(true);
+    mOutput->SetValue(false);
+    Write();
+    CPPUNIT_ASSERT_EQUAL(mOutputMask, mBatch.SetMask);
+
+    // released, clients can set the output again
+    Cycle(false);
+    CPPUNIT_ASSERT(!mEngine.Active(0));
+    CPPUNIT_ASSERT(!mOutput->Held());
+    Write();
+    CPPUNIT_ASSERT_EQUAL(mOutputMask, mBatch.ClearMask);
+    Cycle(false);
+    mOutput->SetValue(true);
+    Write();
+    CPPUNIT_ASSERT_EQUAL(mOutputMask, mBatch.SetMask);
+}
+
+void osaReflexEngine1394Test::TestWhenReleased(void)
+{
+    osaReflexEngine1394::Rule rule;
+    rule.Input = mInput;
+    rule.WhenPressed = false;
+    rule.Output = mOutput;
+    rule.OutputValue = false;
+    mEngine.Add(rule);
+
+    // active while not pressed, output cleared
+    Cycle(false);
+    CPPUNIT_ASSERT(mEngine.Active(0));
+    Write();
+    CPPUNIT_ASSERT_EQUAL(mOutputMask, mBatch.ClearMask);
+
+    // pressed, inactive value
+    Cycle(true);
+    CPPUNIT_ASSERT(!mEngine.Active(0));
+    Write();
+    CPPUNIT_ASSERT_EQUAL(mOutputMask, mBatch.SetMask);
+}
+
+void osaReflexEngine1394Test::TestPowerOffRearm(void)
+{
+    bool sent = false;
+    // inactive or no power, nothing to do
+    CPPUNIT_ASSERT(!osaReflexEngine1394::PowerOffRequired(false, true, sent));
+    CPPUNIT_ASSERT(!osaReflexEngine1394::PowerOffRequired(true, false, sent));
+
+    // active with power, sent once
+    CPPUNIT_ASSERT(osaReflexEngine1394::PowerOffRequired(true, true, sent));
+    CPPUNIT_ASSERT(sent);
+    CPPUNIT_ASSERT(!osaReflexEngine1394::PowerOffRequired(true, true, sent));
+
+    // power seen off then requested again while still active
+    CPPUNIT_ASSERT(!osaReflexEngine1394::PowerOffRequired(true, false, sent));
+    CPPUNIT_ASSERT(!sent);
+    CPPUNIT_ASSERT(osaReflexEngine1394::PowerOffRequired(true, true, sent));
+
+    // released and activated again
+    CPPUNIT_ASSERT(!osaReflexEngine1394::PowerOffRequired(false, true, sent));
+    CPPUNIT_ASSERT(!sent);
+    CPPUNIT_ASSERT(osaReflexEngine1394::PowerOffRequired(true, true, sent));
+}
+
+void osaReflexEngine1394Test::TestJSONDefaults(void)
+{
+    Json::Value jsonReflex;
+    jsonReflex["Input"] = "Clutch";
+    jsonReflex["Output"] = "Light";
+    osaReflex1394Configuration reflex;
+    CPPUNIT_ASSERT(osaJSON1394ConfigureReflex(jsonReflex, "Reflexes[0]", reflex));
+    CPPUNIT_ASSERT_EQUAL(std::string("Clutch"), reflex.Input);
+    CPPUNIT_ASSERT_EQUAL(std::string("Light"), reflex.Output);
+    CPPUNIT_ASSERT(reflex.WhenPressed);
+    CPPUNIT_ASSERT(reflex.OutputValue);
+    CPPUNIT_ASSERT(reflex.PowerOff.empty());
+
+    // input is required
+    Json::Value jsonEmpty(Json::objectValue);
+    CPPUNIT_ASSERT(!osaJSON1394ConfigureReflex(jsonEmpty, "Reflexes[1]", reflex));
+}
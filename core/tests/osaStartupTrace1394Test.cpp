@@ -0,0 +1,75 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sstream>
+
+#include <sawRobotIO1394/osaStartupTrace1394.h>
+
+using namespace sawRobotIO1394;
+
+class osaStartupTrace1394Test : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaStartupTrace1394Test);
+    {
+        CPPUNIT_TEST(TestDisabled);
+        CPPUNIT_TEST(TestEvents);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestDisabled(void);
+    void TestEvents(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaStartupTrace1394Test);
+
+void osaStartupTrace1394Test::TestDisabled(void)
+{
+    osaStartupTrace1394 trace;
+    CPPUNIT_ASSERT(!trace.Enabled());
+    {
+        osaStartupTrace1394::Scope scope(trace, "Configure");
+    }
+    std::stringstream output;
+    trace.ToStream(output);
+    CPPUNIT_ASSERT(output.str().find("Configure") == std::string::npos);
+}
+
+void osaStartupTrace1394Test::TestEvents(void)
+{
+    osaStartupTrace1394 trace;
+    trace.SetFilename("trace.json");
+    CPPUNIT_ASSERT(trace.Enabled());
+    {
+        osaStartupTrace1394::Scope outer(trace, "Configure: \"test\"");
+        osaStartupTrace1394::Scope inner(trace, "QueryBoards", "board");
+        inner.End();
+        inner.End(); // only recorded once
+    }
+    std::stringstream output;
+    trace.ToStream(output);
+    const std::string json = output.str();
+    CPPUNIT_ASSERT(json.find("\"traceEvents\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"name\": \"Configure: \\\"test\\\"\", \"cat\": \"startup\", \"ph\": \"X\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"name\": \"QueryBoards\", \"cat\": \"board\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("QueryBoards") == json.rfind("QueryBoards"));
+    // inner scope ends first
+    CPPUNIT_ASSERT(json.find("QueryBoards") < json.find("Configure"));
+}
@@ -0,0 +1,237 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Created on: 2026-10-18
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstVector/vctDynamicVectorTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+
+#include <sawRobotIO1394/osaPotCoupling1394.h>
+#include <sawRobotIO1394/osaXML1394.h>
+#include <sawRobotIO1394/osaJSON1394.h>
+#include <sawRobotIO1394/osaPotLookupTable1394.h>
+
+using namespace sawRobotIO1394;
+
+// pot to actuator coupling, dense product vs kernel selected at configuration
+void BenchmarkPotCoupling(const size_t iterations)
+{
+    // MTM like coupling, mostly identity
+    vctDoubleMat coupling(7, 7, 0.0);
+    for (size_t index = 0; index < 7; ++index) {
+        coupling.Element(index, index) = 1.0;
+    }
+    coupling.Element(2, 1) = -1.0;
+    coupling.Element(3, 1) = 0.6697;
+    coupling.Element(3, 2) = 0.6697;
+
+    osaPotCoupling1394 kernel;
+    kernel.Configure(coupling);
+
+    vctDoubleVec input(7), output(7);
+    for (size_t index = 0; index < 7; ++index) {
+        input.Element(index) = 0.1 * index;
+    }
+
+    osaStopwatch stopwatch;
+    double check = 0.0;
+
+    stopwatch.Reset();
+    stopwatch.Start();
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+        input.Element(0) = iteration * 1e-9;
+        output.ProductOf(coupling, input);
+        check += output.Element(3);
+    }
+    stopwatch.Stop();
+    const double dense = stopwatch.GetElapsedTime();
+
+    stopwatch.Reset();
+    stopwatch.Start();
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+        input.Element(0) = iteration * 1e-9;
+        kernel.Apply(input, output);
+        check -= output.Element(3);
+    }
+    stopwatch.Stop();
+    const double optimized = stopwatch.GetElapsedTime();
+
+    std::cout << "Pot coupling (" << iterations << " iterations, "
+              << osaPotCoupling1394::KernelToString(kernel.Kernel()) << " kernel)" << std::endl
+              << "  dense product: " << dense * 1.0e9 / iterations << " ns per call" << std::endl
+              << "  kernel:        " << optimized * 1.0e9 / iterations << " ns per call" << std::endl
+              << "  (check " << check << ")" << std::endl;
+}
+
+// configuration loading, XML with one XPath query per attribute vs JSON
+void BenchmarkConfigurationLoading(const size_t numberOfRobots)
+{
+    const size_t numberOfActuators = 7;
+    const std::string xmlFile = "sawRobotIO1394Benchmark.xml";
+    const std::string jsonFile = "sawRobotIO1394Benchmark.json";
+
+    std::ofstream xml(xmlFile);
+    xml << "<Config Version=\"5\">" << std::endl;
+    for (size_t robot = 0; robot < numberOfRobots; ++robot) {
+        xml << "  <Robot Name=\"Robot" << robot << "\" HardwareVersion=\"DQLA\" NumOfActuator=\""
+            << numberOfActuators << "\" SN=\"" << 10000 + robot << "\">" << std::endl;
+        for (size_t actuator = 0; actuator < numberOfActuators; ++actuator) {
+            xml << "    <Actuator AxisID=\"" << actuator << "\" BoardID=\"" << (robot % 8) * 2 << "\" Type=\"Revolute\">" << std::endl
+                << "      <Drive>" << std::endl
+                << "        <AmpsToBits Offset=\"32768\" Scale=\"-5242.88\"/>" << std::endl
+                << "        <BitsToFeedbackAmps Offset=\"6.25\" Scale=\"-0.000190738\"/>" << std::endl
+                << "        <NmToAmps Scale=\"0.404089\"/>" << std::endl
+                << "        <MaxCurrent Unit=\"A\" Value=\"1.340\"/>" << std::endl
+                << "      </Drive>" << std::endl;
+            if (actuator == 0) {
+                xml << "      <AnalogBrake AxisID=\"" << numberOfActuators << "\" BoardID=\"" << (robot % 8) * 2 + 1 << "\">" << std::endl
+                    << "        <AmpsToBits Offset=\"32768\" Scale=\"-5242.88\"/>" << std::endl
+                    << "        <BitsToFeedbackAmps Offset=\"6.25\" Scale=\"-0.000190738\"/>" << std::endl
+                    << "        <MaxCurrent Unit=\"A\" Value=\"0.5\"/>" << std::endl
+                    << "        <ReleaseCurrent Unit=\"A\" Value=\"0.4\"/>" << std::endl
+                    << "        <ReleaseTime Unit=\"s\" Value=\"0.5\"/>" << std::endl
+                    << "        <ReleasedCurrent Unit=\"A\" Value=\"0.1\"/>" << std::endl
+                    << "        <EngagedCurrent Unit=\"A\" Value=\"0.0\"/>" << std::endl
+                    << "      </AnalogBrake>" << std::endl;
+            }
+            xml << "      <Encoder VelocitySource=\"FIRMWARE\">" << std::endl
+                << "        <BitsToPosSI Scale=\"-0.00044248\" Unit=\"deg\"/>" << std::endl
+                << "        <PositionLimitsSoft Lower=\"-90\" Upper=\"90\" Unit=\"deg\"/>" << std::endl
+                << "      </Encoder>" << std::endl
+                << "      <AnalogIn>" << std::endl
+                << "        <BitsToVolts Offset=\"0\" Scale=\"6.86646e-05\"/>" << std::endl
+                << "        <VoltsToPosSI Offset=\"99.177447\" Scale=\"-43.8566137098\" Unit=\"deg\"/>" << std::endl
+                << "      </AnalogIn>" << std::endl
+                << "    </Actuator>" << std::endl;
+        }
+        xml << "    <Potentiometers>" << std::endl;
+        for (size_t actuator = 0; actuator < numberOfActuators; ++actuator) {
+            xml << "      <Tolerance Axis=\"" << actuator << "\" Distance=\"5.0\" Latency=\"0.01\" Unit=\"deg\"/>" << std::endl;
+        }
+        xml << "    </Potentiometers>" << std::endl
+            << "  </Robot>" << std::endl;
+    }
+    xml << "</Config>" << std::endl;
+    xml.close();
+
+    osaStopwatch stopwatch;
+
+    osaPort1394Configuration xmlConfig;
+    stopwatch.Reset();
+    stopwatch.Start();
+    osaXML1394ConfigurePort(xmlFile, xmlConfig, false);
+    stopwatch.Stop();
+    const double xmlTime = stopwatch.GetElapsedTime();
+
+    // same content as mtsRobotIO1394::SaveConfigurationJSON
+    Json::Value jsonValue;
+    xmlConfig.SerializeTextJSON(jsonValue);
+    for (Json::ArrayIndex robot = 0; robot < xmlConfig.Robots.size(); ++robot) {
+        cmnDataJSON<osaAnalogBrake1394Configuration>::SerializeText(*(xmlConfig.Robots.at(robot).Actuators.at(0).Brake),
+                                                                     jsonValue["Robots"][robot]["Actuators"][0]["Brake"]);
+    }
+    std::ofstream json(jsonFile);
+    Json::StyledWriter writer;
+    json << writer.write(jsonValue) << std::endl;
+    json.close();
+
+    osaPort1394Configuration jsonConfig;
+    stopwatch.Reset();
+    stopwatch.Start();
+    osaJSON1394ConfigurePort(jsonFile, jsonConfig, false);
+    stopwatch.Stop();
+    const double jsonTime = stopwatch.GetElapsedTime();
+
+    std::remove(xmlFile.c_str());
+    std::remove(jsonFile.c_str());
+
+    std::cout << "Configuration loading (" << numberOfRobots << " robots, "
+              << numberOfActuators << " actuators each)" << std::endl
+              << "  XML:  " << xmlTime * 1.0e3 << " ms" << std::endl
+              << "  JSON: " << jsonTime * 1.0e3 << " ms" << std::endl
+              << "  (check " << jsonConfig.Robots.size() << " robots, "
+              << jsonConfig.Robots.back().NumberOfBrakes << " brake per robot)" << std::endl;
+}
+
+// lookup table file, JSON tree and matrix vs streaming into actuator tables
+void BenchmarkLookupTableLoading(const size_t numberOfEntries)
+{
+    const size_t numberOfActuators = 8;
+    const std::string lookupFile = "sawRobotIO1394Benchmark-lookup.json";
+    {
+        std::ofstream file(lookupFile.c_str());
+        file.precision(10);
+        file << "{\"serial\": \"12345\", \"lookup\": [";
+        for (size_t actuator = 0; actuator < numberOfActuators; ++actuator) {
+            file << ((actuator == 0) ? "[" : ",\n[");
+            for (size_t entry = 0; entry < numberOfEntries; ++entry) {
+                file << ((entry == 0) ? "" : ", ") << (1.0e-4 * entry + actuator);
+            }
+            file << "]";
+        }
+        file << "]}" << std::endl;
+    }
+
+    std::vector<vctDoubleVec> rows(numberOfActuators);
+    osaStopwatch stopwatch;
+
+    // previous implementation
+    stopwatch.Reset();
+    stopwatch.Start();
+    {
+        std::ifstream jsonStream(lookupFile.c_str());
+        Json::Value jsonValue;
+        Json::Reader jsonReader;
+        jsonReader.parse(jsonStream, jsonValue);
+        vctDoubleMat lookupTable;
+        cmnDataJSON<vctDoubleMat>::DeSerializeText(lookupTable, jsonValue["lookup"]);
+        for (size_t actuator = 0; actuator < numberOfActuators; ++actuator) {
+            rows.at(actuator) = lookupTable.Row(actuator);
+        }
+    }
+    stopwatch.Stop();
+    const double treeTime = stopwatch.GetElapsedTime();
+
+    stopwatch.Reset();
+    stopwatch.Start();
+    std::vector<vctDoubleVec *> tables;
+    for (auto & row : rows) {
+        tables.push_back(&row);
+    }
+    std::string serial, errorMessage;
+    osaPotLookupTable1394ReadFile(lookupFile, serial, tables, errorMessage);
+    stopwatch.Stop();
+    const double streamTime = stopwatch.GetElapsedTime();
+
+    std::remove(lookupFile.c_str());
+
+    std::cout << "Lookup table loading (" << numberOfActuators << " x " << numberOfEntries << ")" << std::endl
+              << "  JSON tree: " << treeTime * 1.0e3 << " ms" << std::endl
+              << "  streaming: " << streamTime * 1.0e3 << " ms" << std::endl
+              << "  (check " << rows.back().size() << " entries)" << std::endl;
+}
+
+int main(void)
+{
+    BenchmarkPotCoupling(10000000);
+    BenchmarkConfigurationLoading(10);
+    BenchmarkLookupTableLoading(65536);
+    return 0;
+}